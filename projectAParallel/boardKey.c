@@ -0,0 +1,86 @@
+/*NAME: boardKey.c
+DATE: Oct 17th 2026
+VERSION: 1.0
+FILENAME: boardKey.c
+PURPOSE: This module will turn boards into the 64 bit keys the search
+	stores and compares them by, and back again. Every tile is a number from
+	0 to 15, so it fits in 4 bits, and the 16 tiles fit in one unsigned
+	64 bit integer. Packing is only shifts and ors, so it needs no string
+	formatting or parsing, and unpacking is only shifts and masks.
+AUTHORS:  Andrew Gendreau
+*/
+
+#include "boardKey.h"
+
+/**
+*Name: encodeBoard
+*Purpose: This function will, given a 1d array representing the board,
+	pack it into a boardKey by shifting each tile into its nibble.
+	The key is built from the top nibble down, so board[0] ends up
+	in the top nibble.
+*Parameters: 
+*	board --array of ints of size BOARDSIZE to represent the board.
+*Returns:
+	key of the board
+**/
+boardKey encodeBoard(int board[BOARDSIZE])
+{
+	boardKey key;							//key being built
+	int i;								//loop control variable
+
+	key = 0;
+
+	for(i = 0; i < BOARDSIZE; i++)
+	{
+		key = (key << TILEBITS) | (boardKey) board[i];
+	}
+
+	return key;
+}
+
+/**
+*Name: decodeBoard
+*Purpose: This function will, given a boardKey, unpack it back into
+	a 1d array representing the board.
+*Parameters: 
+*	key --key to unpack
+	board --array of ints of size BOARDSIZE to fill
+*Returns:
+	void
+**/
+void decodeBoard(boardKey key, int board[BOARDSIZE])
+{
+	int i;								//loop control variable
+
+	for(i = BOARDSIZE - 1; i >= 0; i--)
+	{
+		board[i] = (int) (key & TILEMASK);
+		key = key >> TILEBITS;
+	}
+}
+
+/**
+*Name: applyMoveToKey
+*Purpose: This function will, given the key of a board, the 1d index of
+	the blank and the 1d index of a tile next to it, give the key of the
+	board after that tile slides into the blank. Only those two nibbles
+	change, so the tile is masked out of its own nibble and shifted into
+	the blank's nibble, which is already 0. This is what lets a child's key
+	come from its parent's key without touching the other 14 tiles.
+*Parameters: 
+*	key --key of the board before the move
+	blankIndex --1d index of the blank
+	tileIndex --1d index of the tile moving into the blank
+*Returns:
+	key of the board after the move
+**/
+boardKey applyMoveToKey(boardKey key, int blankIndex, int tileIndex)
+{
+	boardKey tile;							//tile being moved, shifted down to the bottom nibble
+
+	tile = (key >> KEYSHIFT(tileIndex)) & TILEMASK;
+
+	key = key & ~(TILEMASK << KEYSHIFT(tileIndex));
+
+	return key | (tile << KEYSHIFT(blankIndex));
+}
@@ -0,0 +1,69 @@
+/*NAME: boardKey.h
+DATE: Oct 17th 2026
+VERSION: 1.0
+FILENAME: boardKey.h
+PURPOSE: This is the header file for boardKey.c
+AUTHORS:  Andrew Gendreau
+*/
+
+#ifndef PATH_H_
+#define PATH_H_
+#include "pathfinder.h"
+#endif
+
+#define TILEBITS 4							//bits used by one tile in a key
+#define TILEMASK 0xFULL							//mask of one tile once it is shifted down
+
+/*
+* A boardKey is the whole board packed into 64 bits, 4 bits per tile, with
+* board[0] in the top nibble and board[15] in the bottom one. Written in hex
+* it reads the same as the board, the winning state is 0x123456789abcdef0.
+* No two boards share a key, so the key is both the hash value and the board.
+*/
+typedef unsigned long long boardKey;
+
+/*
+* KEYSHIFT gives how far the tile at 1d index i is shifted up in a key,
+* KEYTILE reads the tile at 1d index i straight out of a key.
+*/
+#define KEYSHIFT(i) (TILEBITS * (BOARDSIZE - 1 - (i)))
+#define KEYTILE(key, i) ((int) (((key) >> KEYSHIFT(i)) & TILEMASK))
+
+/**
+*Name: encodeBoard
+*Purpose: This function will, given a 1d array representing the board,
+	pack it into a boardKey by shifting each tile into its nibble.
+*Parameters: 
+*	board --array of ints of size BOARDSIZE to represent the board.
+*Returns:
+	key of the board
+**/
+boardKey encodeBoard(int board[BOARDSIZE]);
+
+/**
+*Name: decodeBoard
+*Purpose: This function will, given a boardKey, unpack it back into
+	a 1d array representing the board.
+*Parameters: 
+*	key --key to unpack
+	board --array of ints of size BOARDSIZE to fill
+*Returns:
+	void
+**/
+void decodeBoard(boardKey key, int board[BOARDSIZE]);
+
+/**
+*Name: applyMoveToKey
+*Purpose: This function will, given the key of a board, the 1d index of
+	the blank and the 1d index of a tile next to it, give the key of the
+	board after that tile slides into the blank. Only those two nibbles
+	change, so the tile is masked out of its own nibble and shifted into
+	the blank's nibble, which is already 0.
+*Parameters: 
+*	key --key of the board before the move
+	blankIndex --1d index of the blank
+	tileIndex --1d index of the tile moving into the blank
+*Returns:
+	key of the board after the move
+**/
+boardKey applyMoveToKey(boardKey key, int blankIndex, int tileIndex);
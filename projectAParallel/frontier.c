@@ -0,0 +1,133 @@
+/*NAME: frontier.c
+DATE: Oct 17th 2026
+VERSION: 1.0
+FILENAME: frontier.c
+PURPOSE: This module will be the frontier used in the breadth first traversal.
+	A breadth first traversal only ever works with two levels at once, the level
+	it is expanding and the level it is adding their children to. So the frontier
+	is two growable arrays, one for each. The nodes of the current level are read
+	straight out of their array in order, children are copied onto the end of the
+	next level's array, and once the current level is done the arrays trade places.
+	The arrays only grow, doubling when they are full, so after the first few levels
+	the traversal does no allocating at all, and walking a level is a walk along
+	contiguous memory.
+AUTHORS:  Andrew Gendreau
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef FRONTIER_H_
+#define FRONTIER_H_
+#include "frontier.h"
+#endif
+
+#ifndef MEMORY_H_
+#define MEMORY_H_
+#include "memoryTracker.h"
+#endif
+
+/**
+*Name: initializeNodeList
+*Purpose: This function will give a level an empty array of
+	INITIALFRONTIERCAPACITY entries.
+*Parameters: 
+*	level --level to initialize
+*Returns:
+	void
+**/
+static void initializeNodeList(struct nodeList *level)
+{
+	level->nodes = trackedMalloc(INITIALFRONTIERCAPACITY * sizeof(struct treeNode *));
+	level->count = 0;
+	level->capacity = INITIALFRONTIERCAPACITY;
+}
+
+/**
+*Name: initializeFrontier
+*Purpose: This function will, given a frontier, give both of its levels
+	an empty array of INITIALFRONTIERCAPACITY entries.
+*Parameters: 
+*	levels --frontier to initialize
+*Returns:
+	void
+**/
+void initializeFrontier(struct frontier *levels)
+{
+	initializeNodeList(&levels->current);
+	initializeNodeList(&levels->next);
+}
+
+/**
+*Name: appendNodes
+*Purpose: This function will, given a level and an array of nodes, copy
+	the nodes onto the end of the level in one go, growing the level's array
+	first if they do not fit. The array doubles each time it grows.
+*Parameters: 
+*	level --level to add to
+	nodes --nodes to add
+	nodeCount --number of nodes to add
+*Returns:
+	void
+**/
+void appendNodes(struct nodeList *level, struct treeNode **nodes, unsigned int nodeCount)
+{
+	unsigned int newCapacity;					//capacity after growing
+
+	if(level->count + nodeCount > level->capacity)
+	{
+		newCapacity = level->capacity;
+
+		while(level->count + nodeCount > newCapacity)
+		{
+			newCapacity = newCapacity * 2;
+		}
+
+		level->nodes = trackedRealloc(level->nodes, level->capacity * sizeof(struct treeNode *),
+			newCapacity * sizeof(struct treeNode *));
+		level->capacity = newCapacity;
+	}
+
+	memcpy(&level->nodes[level->count], nodes, nodeCount * sizeof(struct treeNode *));
+	level->count += nodeCount;
+}
+
+/**
+*Name: advanceLevel
+*Purpose: This function will, once every node of the current level has been
+	expanded, make the next level the current one. The two arrays are swapped
+	and the old current array is emptied to be filled as the new next level, so
+	nothing is freed or allocated.
+*Parameters: 
+*	levels --frontier to advance
+*Returns:
+	void
+**/
+void advanceLevel(struct frontier *levels)
+{
+	struct nodeList finished;					//the level we just expanded
+
+	finished = levels->current;
+	levels->current = levels->next;
+	levels->next = finished;
+	levels->next.count = 0;
+}
+
+/**
+*Name: freeFrontier
+*Purpose: This function will free the arrays of both levels of a frontier.
+	The nodes themselves are not freed.
+*Parameters: 
+*	levels --frontier to free
+*Returns:
+	void
+**/
+void freeFrontier(struct frontier *levels)
+{
+	trackedFree(levels->current.nodes, levels->current.capacity * sizeof(struct treeNode *));
+	trackedFree(levels->next.nodes, levels->next.capacity * sizeof(struct treeNode *));
+
+	levels->current.nodes = NULL;
+	levels->next.nodes = NULL;
+}
@@ -0,0 +1,80 @@
+/*NAME: frontier.h
+DATE: Oct 17th 2026
+VERSION: 1.0
+FILENAME: frontier.h
+PURPOSE: This is a header for frontier.c
+AUTHORS:  Andrew Gendreau
+*/
+
+#define INITIALFRONTIERCAPACITY 64					//starting number of entries in a level's array
+
+/*
+	This is a struct for one level of the breadth first traversal. It is a 
+	growable array of treeNode pointers, count of them are in use and there
+	is room for capacity of them before the array has to grow.
+*/
+struct nodeList
+{
+	struct treeNode **nodes;					//the nodes on this level, in the order they were added
+	unsigned int count;						//number of nodes in the array
+	unsigned int capacity;						//number of nodes the array has room for
+};
+
+/*
+	This is a struct for the frontier of the breadth first traversal. It holds
+	the level being expanded and the level its children are being added to.
+*/
+struct frontier
+{
+	struct nodeList current;					//nodes on the level we are expanding
+	struct nodeList next;						//children found so far, the level after current
+};
+
+/**
+*Name: initializeFrontier
+*Purpose: This function will, given a frontier, give both of its levels
+	an empty array of INITIALFRONTIERCAPACITY entries.
+*Parameters: 
+*	levels --frontier to initialize
+*Returns:
+	void
+**/
+void initializeFrontier(struct frontier *levels);
+
+/**
+*Name: appendNodes
+*Purpose: This function will, given a level and an array of nodes, copy
+	the nodes onto the end of the level in one go, growing the level's array
+	first if they do not fit.
+*Parameters: 
+*	level --level to add to
+	nodes --nodes to add
+	nodeCount --number of nodes to add
+*Returns:
+	void
+**/
+void appendNodes(struct nodeList *level, struct treeNode **nodes, unsigned int nodeCount);
+
+/**
+*Name: advanceLevel
+*Purpose: This function will, once every node of the current level has been
+	expanded, make the next level the current one. The two arrays are swapped
+	and the old current array is emptied to be filled as the new next level, so
+	nothing is freed or allocated.
+*Parameters: 
+*	levels --frontier to advance
+*Returns:
+	void
+**/
+void advanceLevel(struct frontier *levels);
+
+/**
+*Name: freeFrontier
+*Purpose: This function will free the arrays of both levels of a frontier.
+	The nodes themselves are not freed.
+*Parameters: 
+*	levels --frontier to free
+*Returns:
+	void
+**/
+void freeFrontier(struct frontier *levels);
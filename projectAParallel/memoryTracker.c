@@ -0,0 +1,147 @@
+/*NAME: memoryTracker.c
+DATE: Oct 17th 2026
+VERSION: 1.0
+FILENAME: memoryTracker.c
+PURPOSE: This module will wrap malloc, calloc, realloc and free so the solver
+	can count how many heap allocations it makes and how many bytes it holds.
+	Every module of the search allocates through these functions, so the
+	totals in memoryUsage cover the whole search. The callers pass the size of
+	a block when they free it, this way the module does not need to keep a
+	header in front of every block to know how big it was.
+	The totals are how we check that the expansion loop does not allocate
+	per node and what the peak memory of a solve was.
+AUTHORS:  Andrew Gendreau
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "memoryTracker.h"
+
+struct memoryStats memoryUsage = {0, 0, 0, 0};				//totals for the whole run
+
+/**
+*Name: countAllocation
+*Purpose: This function will, given the size of a new block, add it to
+	the totals and move the peak up if we are holding more than ever before.
+*Parameters: 
+	size --size of the new block
+*Returns:
+	void
+**/
+static void countAllocation(size_t size)
+{
+	memoryUsage.allocations++;
+	memoryUsage.currentBytes += size;
+
+	if(memoryUsage.currentBytes > memoryUsage.peakBytes)
+	{
+		memoryUsage.peakBytes = memoryUsage.currentBytes;
+	}
+}
+
+/**
+*Name: trackedMalloc
+*Purpose: This function will allocate size bytes with malloc and count
+	the allocation. If malloc fails, it will tell the user and exit.
+*Parameters: 
+	size --number of bytes wanted
+*Returns:
+	pointer to the new memory
+**/
+void *trackedMalloc(size_t size)
+{
+	void *newMemory;						//memory to be returned
+
+	newMemory = malloc(size);
+
+	if(newMemory == NULL)
+	{
+		printf("Malloc error!\n");
+		exit(1);
+	}
+
+	countAllocation(size);
+
+	return newMemory;
+}
+
+/**
+*Name: trackedCalloc
+*Purpose: This function will allocate count zeroed elements of size bytes
+	with calloc and count the allocation. If calloc fails, it will tell the
+	user and exit.
+*Parameters: 
+	count --number of elements wanted
+	size --size of one element
+*Returns:
+	pointer to the new memory
+**/
+void *trackedCalloc(size_t count, size_t size)
+{
+	void *newMemory;						//memory to be returned
+
+	newMemory = calloc(count, size);
+
+	if(newMemory == NULL)
+	{
+		printf("Malloc error!\n");
+		exit(1);
+	}
+
+	countAllocation(count * size);
+
+	return newMemory;
+}
+
+/**
+*Name: trackedRealloc
+*Purpose: This function will resize a tracked block with realloc and
+	count it as an allocation. If realloc fails, it will tell the user and exit.
+*Parameters: 
+	pointer --block to resize, may be NULL
+	oldSize --size the block was allocated with
+	newSize --size wanted
+*Returns:
+	pointer to the resized memory
+**/
+void *trackedRealloc(void *pointer, size_t oldSize, size_t newSize)
+{
+	void *newMemory;						//memory to be returned
+
+	newMemory = realloc(pointer, newSize);
+
+	if(newMemory == NULL)
+	{
+		printf("Malloc error!\n");
+		exit(1);
+	}
+
+	memoryUsage.currentBytes -= oldSize;
+	countAllocation(newSize);
+
+	return newMemory;
+}
+
+/**
+*Name: trackedFree
+*Purpose: This function will free a tracked block and take its size
+	off the bytes currently held.
+*Parameters: 
+	pointer --block to free, may be NULL
+	size --size the block was allocated with
+*Returns:
+	void
+**/
+void trackedFree(void *pointer, size_t size)
+{
+	if(pointer == NULL)
+	{
+		return;
+	}
+
+	free(pointer);
+
+	memoryUsage.frees++;
+	memoryUsage.currentBytes -= size;
+}
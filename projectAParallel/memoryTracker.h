@@ -0,0 +1,73 @@
+/*NAME: memoryTracker.h
+DATE: Oct 17th 2026
+VERSION: 1.0
+FILENAME: memoryTracker.h
+PURPOSE: This is the header file for memoryTracker.c
+AUTHORS:  Andrew Gendreau
+*/
+
+#include <stddef.h>
+
+/*
+* This struct holds the running totals of the heap use that went through
+* the tracked allocation functions. Allocations and frees are counts of calls,
+* the byte counts are what is held right now and the most ever held at once.
+*/
+struct memoryStats
+{
+	unsigned long long allocations;					//number of successful allocations, reallocations included
+	unsigned long long frees;					//number of tracked frees
+	size_t currentBytes;						//bytes allocated and not yet freed
+	size_t peakBytes;						//the most currentBytes has ever been
+};
+
+extern struct memoryStats memoryUsage;					//totals for the whole run
+
+/**
+*Name: trackedMalloc
+*Purpose: This function will allocate size bytes with malloc and count
+	the allocation. If malloc fails, it will tell the user and exit.
+*Parameters: 
+	size --number of bytes wanted
+*Returns:
+	pointer to the new memory
+**/
+void *trackedMalloc(size_t size);
+
+/**
+*Name: trackedCalloc
+*Purpose: This function will allocate count zeroed elements of size bytes
+	with calloc and count the allocation. If calloc fails, it will tell the
+	user and exit.
+*Parameters: 
+	count --number of elements wanted
+	size --size of one element
+*Returns:
+	pointer to the new memory
+**/
+void *trackedCalloc(size_t count, size_t size);
+
+/**
+*Name: trackedRealloc
+*Purpose: This function will resize a tracked block with realloc and
+	count it as an allocation. If realloc fails, it will tell the user and exit.
+*Parameters: 
+	pointer --block to resize, may be NULL
+	oldSize --size the block was allocated with
+	newSize --size wanted
+*Returns:
+	pointer to the resized memory
+**/
+void *trackedRealloc(void *pointer, size_t oldSize, size_t newSize);
+
+/**
+*Name: trackedFree
+*Purpose: This function will free a tracked block and take its size
+	off the bytes currently held.
+*Parameters: 
+	pointer --block to free, may be NULL
+	size --size the block was allocated with
+*Returns:
+	void
+**/
+void trackedFree(void *pointer, size_t size);
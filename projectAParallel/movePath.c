@@ -0,0 +1,58 @@
+/*NAME: movePath.c
+DATE: Oct 17th 2026
+VERSION: 1.0
+FILENAME: movePath.c
+PURPOSE: This module will hold the winning path of a search. The path is
+	filled in as move codes, one byte a move, by walking up from the winning
+	node once, and is only written out as text when it is going to be printed.
+AUTHORS:  Andrew Gendreau
+*/
+
+#ifndef MOVEPATH_H_
+#define MOVEPATH_H_
+#include "movePath.h"
+#endif
+
+/**
+*Name: formatMovePath
+*Purpose: This function will, given a path, write it into text as moves like
+	4U 8L with a space between moves, in one pass over the path.
+*Parameters: 
+*	path --path to write out
+	text --buffer to write into, PATHTEXTSIZE characters is always enough
+*Returns:
+	the number of characters written, not counting the null terminator
+**/
+int formatMovePath(struct movePath *path, char *text)
+{
+	int i;									//loop control variable
+	int length;								//characters written so far
+	int tile;								//tile moved by the current move
+
+	length = 0;
+
+	for(i = 0; i < path->length; i++)
+	{
+		if(i > 0)
+		{
+			text[length] = ' ';
+			length++;
+		}
+
+		tile = CODETILE(path->moves[i]);
+
+		if(tile >= 10)							//tiles 10 to 15 take two digits
+		{
+			text[length] = '0' + tile / 10;
+			length++;
+		}
+
+		text[length] = '0' + tile % 10;
+		text[length + 1] = DIRECTIONLETTERS[CODEDIRECTION(path->moves[i])];
+		length += 2;
+	}
+
+	text[length] = '\0';
+
+	return length;
+}
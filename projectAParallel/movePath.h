@@ -0,0 +1,52 @@
+/*NAME: movePath.h
+DATE: Oct 17th 2026
+VERSION: 1.0
+FILENAME: movePath.h
+PURPOSE: This is a header for movePath.c
+AUTHORS:  Andrew Gendreau
+*/
+
+#ifndef PATH_H_
+#define PATH_H_
+#include "pathfinder.h"
+#endif
+
+#define MAXPATHLENGTH 80					//no solvable 15 puzzle needs more than 80 moves
+#define MOVETEXTSIZE 4						//most characters one move takes as text, with its separating space
+#define PATHTEXTSIZE (MAXPATHLENGTH * MOVETEXTSIZE + 1)		//characters the text of the longest path can take
+#define NOMOVECODE 0xFF						//move code of a node no move was made into, the root
+
+/*
+* A moveCode is one move packed into a byte, the tile that moved in the
+* top six bits and the direction code it moved in in the bottom two.
+* MOVECODE packs a move, CODETILE and CODEDIRECTION unpack it.
+*/
+typedef unsigned char moveCode;
+
+#define MOVECODE(tile, direction) ((moveCode) (((tile) << 2) | (direction)))
+#define CODETILE(code) ((int) ((code) >> 2))
+#define CODEDIRECTION(code) ((int) ((code) & 3))
+
+/*
+	This is a struct for the moves from a starting board to a finishing one,
+	in the order they are made. The moves are kept as codes, one byte each,
+	so the whole path can be sent or stored as it is and is only turned into
+	text when it is printed.
+*/
+struct movePath
+{
+	int length;						//number of moves on the path
+	moveCode moves[MAXPATHLENGTH];				//the moves, first to last
+};
+
+/**
+*Name: formatMovePath
+*Purpose: This function will, given a path, write it into text as moves like
+	4U 8L with a space between moves, in one pass over the path.
+*Parameters: 
+*	path --path to write out
+	text --buffer to write into, PATHTEXTSIZE characters is always enough
+*Returns:
+	the number of characters written, not counting the null terminator
+**/
+int formatMovePath(struct movePath *path, char *text);
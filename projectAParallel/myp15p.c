@@ -65,23 +65,27 @@ int main(int argc, char *argv[])
 									//in the form of a file.
 	FILE *filePointer;						//pointer to the input file
 	int solvableTest;						//return from the solvability test
-	int oneDInputBoard[BOARDWIDTH];					//variable to hold the 1D form of the given input board
+	int oneDInputBoard[BOARDSIZE];					//variable to hold the 1D form of the given input board
 	char userInput[LINESIZE];					//character array to hold the user's given fileNames
 	char currentChar;						//current character in the user input
 	int i;								//loop control variable
 	int j;								//another loop control variable
 	int nodesToSendToThisProcess;					//nodes we are going to send to this process	
+	unsigned int nodesSent;						//nodes of the current level sent out so far
 	int my_PE_num;							//my processing element number
 	int numprocs;							//the number of executing processes
 	int haveWeFoundAWinner;						//integer to signal us if we've won
-	int leftOver;							//remainder of the number of nodes in the queue once we've generated
+	int leftOver;							//remainder of the number of nodes in the level once we've generated
 									//enough
 	int numberOfNodesToSend;					//number of nodes to send to each process from the master
-	int originalNumberOfNodes;					//original number of nodes from the queue to send assuming no
+	int originalNumberOfNodes;					//original number of nodes from the level to send assuming no
 									//remainder
 	MPI_Status status;						//MPI status variable, needed for non-blocking sends and recieves
 	int winningDepth;						//Winning depth
-	char *victoryPath;						//character pointer, used to point to the moves that won
+	char *victoryPath;						//character pointer, unused by processLevel
+	struct movePath winningPath;					//the moves that won, as move codes
+	struct movePath workerPath;					//the moves the winning worker made from its mini tree's root
+	char winningText[PATHTEXTSIZE];					//the moves that won, as text
 	clock_t start;							//clock_t variable to hold the starting time information
 	clock_t end;							//clock_t variable to hold the ending time information
 	clock_t timeDiff;						//clock_t variable to hold the difference between previous 2
@@ -107,20 +111,22 @@ int main(int argc, char *argv[])
 
 	buff.myRank = my_PE_num;
 
-	const int nitems = 6;									//number of fields in the struct
-	int blockLengths[6] = {16,1,1,4,1,(int)sizeof(struct treeNodeParentMPI)};		//number of things in each field
-	MPI_Datatype types[6] = {MPI_INT, MPI_LONG, MPI_INT, MPI_CHAR, MPI_INT, MPI_BYTE};	//the types of each field
+	const int nitems = 7;									//number of fields in the struct
+	int blockLengths[7] = {16,1,1,1,1,1,(int)sizeof(struct treeNodeParentMPI)};		//number of things in each field
+	MPI_Datatype types[7] = {MPI_INT, MPI_UNSIGNED_LONG_LONG, MPI_INT, MPI_INT, MPI_UNSIGNED_CHAR, MPI_INT,
+		MPI_BYTE};									//the types of each field
 	MPI_Datatype MPI_YGGDRASILNODE;								//the name of the new datatype
-	MPI_Aint offsets[6];									//an array to hold the memory offsets of
+	MPI_Aint offsets[7];									//an array to hold the memory offsets of
 												//each field, easily obtained via offsetof
 	
 	//The following assignments set an array of offset values for each field in the struct
 	offsets[0] = offsetof(struct treeNode, board);
 	offsets[1] = offsetof(struct treeNode, hashVal);
-	offsets[2] = offsetof(struct treeNode, depth);
-	offsets[3] = offsetof(struct treeNode, moveFromParent);
-	offsets[4] = offsetof(struct treeNode, nodeID);
-	offsets[5] = offsetof(struct treeNode, parentCopy);
+	offsets[2] = offsetof(struct treeNode, blankIndex);
+	offsets[3] = offsetof(struct treeNode, depth);
+	offsets[4] = offsetof(struct treeNode, move);
+	offsets[5] = offsetof(struct treeNode, nodeID);
+	offsets[6] = offsetof(struct treeNode, parentCopy);
 
 	MPI_Type_create_struct(nitems, blockLengths, offsets, types, &MPI_YGGDRASILNODE);
 	MPI_Type_commit(&MPI_YGGDRASILNODE);
@@ -177,27 +183,28 @@ int main(int argc, char *argv[])
 
 			createRoot(oneDInputBoard);
 
-			haveWeFoundAWinner = processLevel(1, victoryPath);
+			haveWeFoundAWinner = processLevel(victoryPath);
 
-			while(currentLevelNodeCount < numprocs && haveWeFoundAWinner < 0)		
+			while(searchFrontier.current.count < numprocs && haveWeFoundAWinner < 0)		
 			{
-				haveWeFoundAWinner = processLevel(currentLevelNodeCount, victoryPath);
+				haveWeFoundAWinner = processLevel(victoryPath);
 			}
 
 			if(haveWeFoundAWinner > 0)
 			{
-				victoryPath = traverseWinningPath(winner);
-				printf("Our winning path needs %d moves\n", (winner->depth));
-				printf("The moves required are: %s\n", victoryPath);
+				traceWinningPath(winner, &winningPath);
+				formatMovePath(&winningPath, winningText);
+				printf("Our winning path needs %d moves\n", winningPath.length);
+				printf("The moves required are: %s\n", winningText);
 				return 0;
 			}
 			else								
 			{
 				buff.myValue = -10;
 
-				originalNumberOfNodes = currentLevelNodeCount / (numprocs-1);
+				originalNumberOfNodes = searchFrontier.current.count / (numprocs-1);
 				numberOfNodesToSend = originalNumberOfNodes;
-				leftOver = currentLevelNodeCount % (numprocs-1);
+				leftOver = searchFrontier.current.count % (numprocs-1);
 
 				while(i < numprocs)
 				{
@@ -219,6 +226,7 @@ int main(int argc, char *argv[])
 				}
 
 				i = 1;
+				nodesSent = 0;
 
 				while(i < numprocs)		//send to all the processes
 				{
@@ -228,9 +236,14 @@ int main(int argc, char *argv[])
 
 					for(j = 0; j < nodesToSendToThisProcess; j++)
 					{
-						nodePtr = deQueue();
+						nodePtr = searchFrontier.current.nodes[nodesSent];
+						nodesSent++;
 						treeNodeArray[j] = *nodePtr;
 
+						memcpy(treeNodeArray[j].parentCopy.board, nodePtr->parent->board, sizeof(nodePtr->parent->board));
+						treeNodeArray[j].parentCopy.hashVal = nodePtr->parent->hashVal;
+						treeNodeArray[j].parentCopy.depth = nodePtr->parent->depth;
+						treeNodeArray[j].parentCopy.nodeID = nodePtr->parent->nodeID;
 					}
 					MPI_Send(&treeNodeArray, nodesToSendToThisProcess, MPI_YGGDRASILNODE, i, 1, MPI_COMM_WORLD);
 					i++;
@@ -251,6 +264,7 @@ int main(int argc, char *argv[])
 		MPI_Request request;					//MPI_Request variable
 		int messageFlag;					//flag to signify we've recieved a messaged
 		int nodesToRecieve;
+		struct treeNode *branchNode;				//node we were sent that the winning path goes through
 
 		messageFlag = 0;
 		depthRecieved = 99999;					//set to a random really high number at first so we know we
@@ -264,12 +278,14 @@ int main(int argc, char *argv[])
 
 		MPI_Recv(&treeNodeArray, nodesToRecieve, MPI_YGGDRASILNODE, 0, 1, MPI_COMM_WORLD, &status);
 
+		initializeFrontier(&searchFrontier);
+
 		for(j = 0; j < nodesToRecieve; j++)				//insert all the obtained nodes as 
-											//the root node's children and enqueue them
+											//the root node's children and add them to the frontier
 		{
 			currentNodePtr = &treeNodeArray[j];
 
-			if(j == 0)							//i don't want to enqueue this node
+			if(j == 0)							//i don't want to add this node to the frontier
 			{
 				currentDepth = 1;
 
@@ -285,10 +301,10 @@ int main(int argc, char *argv[])
 			{
 				insertIntoYggdrasil(currentNodePtr, branchRoot->root);
 			}
-			enQueue(currentNodePtr);
+			appendNodes(&searchFrontier.current, &currentNodePtr, 1);
 		}
 
-		haveWeFoundAWinner = processLevel(nodesToRecieve, pathOfVictory);
+		haveWeFoundAWinner = processLevel(pathOfVictory);
 
 		MPI_Irecv(&depthRecieved, 1, MPI_INT, MPI_ANY_SOURCE, 10, MPI_COMM_WORLD, &request);
 
@@ -313,7 +329,7 @@ int main(int argc, char *argv[])
 			}
 			else						
 			{
-				haveWeFoundAWinner = processLevel(currentLevelNodeCount, pathOfVictory);
+				haveWeFoundAWinner = processLevel(pathOfVictory);
 			}
 		}
 		winningDepth = haveWeFoundAWinner;
@@ -322,14 +338,18 @@ int main(int argc, char *argv[])
 		if(winner != NULL && winningDepth > 0 && winningDepth < depthRecieved)		//This is when a process finds a winner
 		{
 			MPI_Cancel(&request);							//cancel a request if we have one
-			pathOfVictory = traverseWinningPath(winner);
-			int pathLength;								//this is the length of the winning path
-			pathLength = (int) strlen(pathOfVictory);
-			int pathAndDepth[2];							//this array holds the winning depth
-												//and the path length (number of moves)
+			traceWinningPath(winner, &winningPath);
+			int pathAndDepth[3];							//this array holds the path length (number of moves),
+												//the winning depth and which sent node it goes through
+
+			for(branchNode = winner; branchNode->parent != branchRoot->root; branchNode = branchNode->parent)
+			{
+				//walk up to the node we were sent
+			}
 
-			pathAndDepth[0] = pathLength;
+			pathAndDepth[0] = winningPath.length;
 			pathAndDepth[1] = currentDepth;
+			pathAndDepth[2] = (int) (branchNode - treeNodeArray);
 
 			for(j = 1; j < numprocs; j++)					//tell everybody except myself I found a winner
 			{
@@ -338,8 +358,8 @@ int main(int argc, char *argv[])
 					MPI_Send(&winningDepth, 1, MPI_INT, j, 10, MPI_COMM_WORLD);
 				}
 			}
-			MPI_Send(&pathAndDepth, 2, MPI_INT, 0, 20, MPI_COMM_WORLD);
-			MPI_Send(pathOfVictory, pathLength, MPI_CHAR, 0, 30, MPI_COMM_WORLD);
+			MPI_Send(&pathAndDepth, 3, MPI_INT, 0, 20, MPI_COMM_WORLD);
+			MPI_Send(winningPath.moves, winningPath.length, MPI_BYTE, 0, 30, MPI_COMM_WORLD);	//one byte a move
 		}
 	}
 
@@ -347,17 +367,38 @@ int main(int argc, char *argv[])
 
 	if(my_PE_num == 0)
 	{
-		int depthAndLength[2];								//Variable to hold the send from the winner
+		int depthAndLength[3];								//Variable to hold the send from the winner
 												//from process 0.
+		unsigned int sentIndex;								//index in the master's level of the node
+												//the winning path goes through
 		end = clock();
 		timeDiff = end - start;
 		millSeconds = timeDiff * 1000 / CLOCKS_PER_SEC;
 
 		seconds = millSeconds / 1000.0;
 
-		MPI_Recv(&depthAndLength, 2, MPI_INT, out.myRank, 20, MPI_COMM_WORLD, &status);
+		MPI_Recv(&depthAndLength, 3, MPI_INT, out.myRank, 20, MPI_COMM_WORLD, &status);
+		MPI_Recv(workerPath.moves, depthAndLength[0], MPI_BYTE, out.myRank, 30, MPI_COMM_WORLD, &status);
+		workerPath.length = depthAndLength[0];
+
+		sentIndex = (unsigned int) depthAndLength[2];					//the worker's nodes came after those
+		for(i = 1; i < out.myRank; i++)							//of every process before it
+		{
+			sentIndex += nodesPerProcess[i-1];
+		}
+
+		traceWinningPath(searchFrontier.current.nodes[sentIndex], &winningPath);	//our moves down to that node
+
+		for(i = 1; i < workerPath.length && winningPath.length < MAXPATHLENGTH; i++)	//then the worker's, its first is
+		{										//the move into that node again
+			winningPath.moves[winningPath.length] = workerPath.moves[i];
+			winningPath.length++;
+		}
+
+		formatMovePath(&winningPath, winningText);
 
-		printf("The shortest path has %d moves\n", (currentDepth + depthAndLength[1]));
+		printf("The shortest path has %d moves\n", winningPath.length);
+		printf("The moves found by process %d are: %s\n", out.myRank, winningText);
 		printf("Solving this puzzle took %f seconds when measured from process 0\n", seconds);
 	}
 	MPI_Finalize();
@@ -30,13 +30,12 @@ AUTHOR: Andrew Gendreau
 #include "functions-2.h"
 #endif
 
-#ifndef QUEUE_H_
-#define QUEUE_H_
-#include "queue.h"
+#ifndef FRONTIER_H_
+#define FRONTIER_H_
+#include "frontier.h"
 #endif
 
-extern int nextLevelNodeCount;						//inital value of the next level counter
-extern int currentLevelNodeCount;					//node count at the current level
+extern struct frontier searchFrontier;					//the current and next level of the traversal
 extern struct tree *treeRoot;						//root of the tree of board positions and moves
 struct treeNode *winner = NULL;						//winning node
 int endingSignal;							//global integer to signify we've ended (I might remove it)
@@ -1,12 +1,15 @@
 /*NAME: pathfinder.h
 DATE: Oct 14th 2016
-VERSION: 2.0
+VERSION: 3.0
 FILENAME: hashList.h
 PURPOSE: This is a module to find the possible moves and the indexes of the tiles
 	we can swap. It will assume the input is a 1d array representing the game board.
-	It will have a function to compute the x and y coordinate of the index of the blank,
-	find the directions that tiles around the blank can move in from, then compute the
-	1D array index of those tiles that can move into the blank space.
+	It will have a function to compute the x and y coordinate of the index of the blank.
+	The directions that tiles around the blank can move in from, and the 1D array index
+	of those tiles that can move into the blank space, only depend on where the blank is,
+	so they are worked out once for each of the 16 blank positions and kept in the
+	constant move tables below. Finding the moves of a node is then a table lookup
+	instead of computing and allocating them for every node.
 AUTHORS:  Andrew Gendreau
 */
 
@@ -16,6 +19,54 @@ AUTHORS:  Andrew Gendreau
 
 #include "pathfinder.h"
 
+const int movesForBlank[BOARDSIZE] = {2, 3, 3, 2, 3, 4, 4, 3, 3, 4, 4, 3, 2, 3, 3, 2};
+
+/*
+* Tiles are listed in the order down, up, right, left, the order the
+* directions were always tried in. A tile above the blank moves down,
+* one below moves up, one to the left moves right and one to the right
+* moves left.
+*/
+const int tilesForBlank[BOARDSIZE][MAXMOVES] = 
+{
+	{ 4,  1, -1, -1},						//blank at 0
+	{ 5,  0,  2, -1},						//blank at 1
+	{ 6,  1,  3, -1},						//blank at 2
+	{ 7,  2, -1, -1},						//blank at 3
+	{ 0,  8,  5, -1},						//blank at 4
+	{ 1,  9,  4,  6},						//blank at 5
+	{ 2, 10,  5,  7},						//blank at 6
+	{ 3, 11,  6, -1},						//blank at 7
+	{ 4, 12,  9, -1},						//blank at 8
+	{ 5, 13,  8, 10},						//blank at 9
+	{ 6, 14,  9, 11},						//blank at 10
+	{ 7, 15, 10, -1},						//blank at 11
+	{ 8, 13, -1, -1},						//blank at 12
+	{ 9, 12, 14, -1},						//blank at 13
+	{10, 13, 15, -1},						//blank at 14
+	{11, 14, -1, -1}						//blank at 15
+};
+
+const int directionsForBlank[BOARDSIZE][MAXMOVES] = 
+{
+	{MOVEUP, MOVELEFT, NOMOVE, NOMOVE},				//blank at 0
+	{MOVEUP, MOVERIGHT, MOVELEFT, NOMOVE},				//blank at 1
+	{MOVEUP, MOVERIGHT, MOVELEFT, NOMOVE},				//blank at 2
+	{MOVEUP, MOVERIGHT, NOMOVE, NOMOVE},				//blank at 3
+	{MOVEDOWN, MOVEUP, MOVELEFT, NOMOVE},				//blank at 4
+	{MOVEDOWN, MOVEUP, MOVERIGHT, MOVELEFT},			//blank at 5
+	{MOVEDOWN, MOVEUP, MOVERIGHT, MOVELEFT},			//blank at 6
+	{MOVEDOWN, MOVEUP, MOVERIGHT, NOMOVE},				//blank at 7
+	{MOVEDOWN, MOVEUP, MOVELEFT, NOMOVE},				//blank at 8
+	{MOVEDOWN, MOVEUP, MOVERIGHT, MOVELEFT},			//blank at 9
+	{MOVEDOWN, MOVEUP, MOVERIGHT, MOVELEFT},			//blank at 10
+	{MOVEDOWN, MOVEUP, MOVERIGHT, NOMOVE},				//blank at 11
+	{MOVEDOWN, MOVELEFT, NOMOVE, NOMOVE},				//blank at 12
+	{MOVEDOWN, MOVERIGHT, MOVELEFT, NOMOVE},			//blank at 13
+	{MOVEDOWN, MOVERIGHT, MOVELEFT, NOMOVE},			//blank at 14
+	{MOVEDOWN, MOVERIGHT, NOMOVE, NOMOVE}				//blank at 15
+};
+
 /**
 *Name: findBlankIndex
 *Purpose: This function will, given a 1d array representing the board,
@@ -87,150 +138,6 @@ int findY(int OneDblankIndex)
 	return blankY;
 }
 
-/**
-*Name: numberofMovesPossible
-*Purpose: This function will, given the x and y coordinate of the blank,
-	compute the number of moves possible. It will do this by using a switch,
-	using the following heuristic:
-		We will start assuming 4 moves are possible, if either the x or y
-		coordinate is 0 or 3, we cannot make at least one move in that dimension.
-		This assumes that we can make at least 2 moves, which we always should be
-		able to, the worst case is when the blank is in a corner, in which case we have
-		2 moves.
-*Parameters: 
-	blankX --x coordinate of the blank
-	blankY --y coordinate of the blank
-*Returns:
-	the number of moves possible
-**/
-int numberofMovesPossible(int blankX, int blankY)
-{
-	int movesPossible;					//moves possible
-	
-	movesPossible = 4;
-
-	switch(blankX)
-	{
-		case 0:
-			movesPossible--;
-			break;
-		case 3:
-			movesPossible--;
-			break;
-	}
-	switch(blankY)
-	{
-		case 0:
-			movesPossible--;
-			break;
-		case 3:
-			movesPossible--;
-			break;
-	}
-
-	return movesPossible;
-}
-
-/**
-*Name: findMoveDirections
-*Purpose: This function will, given the number of moves possible,
-	the x and y coordinates of the blank, find the 
-	directions tiles can move to trade positions with the blank.
-	It will represent the directions as a char array, using the following
-	representation:
-		U -UP -tile can move up
-		R -Right -tile can move right
-		L -Left	-tile can move left
-		D -Down	-tile can move down
-*Parameters: 
-	movesPossible --number of moves possible
-	blankX --x coordinate of the blank
-	blankY --y coordinate of the blank
-*Returns:
-	char array representing the possible directions
-**/
-char *findMoveDirections(int movesPossible, int blankX, int blankY)
-{
-	char *moveDirections;					//character string to represent the move directions
-	int i;							//loop control variable
-
-	moveDirections = malloc((movesPossible) * sizeof(char));
-	i = 0;
-
-	if((blankY - 1) >= 0)					//check the Ys
-	{
-		moveDirections[i] = 'D';
-		i++;
-	}
-	if((blankY + 1) <= 3)
-	{
-		moveDirections[i] = 'U';
-		i++;
-	}
-
-	if((blankX - 1) >= 0)					//check the Xs
-	{
-		moveDirections[i] = 'R';
-		i++;
-	}
-	if((blankX + 1) <= 3)
-	{
-		moveDirections[i] = 'L';
-		i++;
-	}
-	moveDirections[i] = '\0';
-	return 	moveDirections;
-}
-
-/**
-*Name: tilesToMoveIn
-*Purpose: This function will, given the number of moves possible,
-	the x and y coordinates of the blank, and the move directions,
-	find the 1D array indexes of the tiles that can move in.
-	it will compute the 1d array index as follows:
-		1d array index: Y * 4 + X
-		This gives us the 1d mapping of a given 2d coordinate.
-*Parameters: 
-	moveDirections --directions tiles can move in from
-	movesPossible --number of moves possible
-	blankX --x coordinate of the blank
-	blankY --y coordinate of the blank
-*Returns:
-	int array representing the indexes of the tiles that can be moved in
-**/
-int *tilesToMoveIn(int movesPossible, int blankX, int blankY, char *moveDirections)
-{
-	int *tile1Dindexes;						//int array representing the 1d indexes
-	int i;								//loop control variable
-	int currentValue;						//current index
-
-	tile1Dindexes = malloc(movesPossible * sizeof(int));
-	
-	for(i = 0; i < movesPossible; i++)
-	{
-		switch(moveDirections[i])
-		{
-			case 'U':					//case when a tile can move up into the blank space
-				currentValue = ((blankY+1) * 4) + blankX;
-				tile1Dindexes[i] = currentValue;
-				break;
-			case 'D':					//case when a tile can move down into the blank space
-				currentValue = ((blankY-1) * 4) + blankX;
-				tile1Dindexes[i] = currentValue;
-				break;		
-			case 'R':					//case when a tile can move right into the blank space
-				currentValue = (blankY * 4) + (blankX-1);
-				tile1Dindexes[i] = currentValue;
-				break;
-			case 'L':					//case when a tile can move left into the blank space
-				currentValue = (blankY * 4) + (blankX+1);
-				tile1Dindexes[i] = currentValue;
-				break;
-		}
-	}	
-	return tile1Dindexes;
-}
-
 /**
 *Name: swap
 *Purpose: This function will, given the 1d index of the blank,
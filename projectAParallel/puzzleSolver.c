@@ -16,12 +16,12 @@ PURPOSE: This module will be the algorithm implementer module.
 			8. Do this for every node on level l.
 			8a: If the hash for child c is the winning one, stop, we've found our winning state.
 			8b: else, we have exhausted this level, increment l and move down.
-	The breadth first traversal needed for this algorithm to work will be implemented using a queue as follows:
-		Keep two counters, one will hold the number of nodes at the current level
-		de queue nodes one by one until we've done all for that level, when we insert new nodes into Yggdrasil,
-		we will increment the second counter meant to hold the nodes in the next level.
-		Once we have dealt with all the nodes at a given level, we will put the second counter's value into the first
-		one and set the second counter to 0.
+	The breadth first traversal needed for this algorithm to work will be implemented using a frontier as follows:
+		Keep two arrays, one will hold the nodes at the current level and one the nodes at the next level.
+		Go through the current level's array in order, when we insert new nodes into Yggdrasil,
+		we will add them to the end of the next level's array.
+		Once we have dealt with all the nodes at a given level, the arrays trade places, the next level
+		becomes the current one and the old current array is emptied to hold the level after it.
 AUTHOR: Andrew Gendreau
 */
 
@@ -36,8 +36,7 @@ AUTHOR: Andrew Gendreau
 
 
 int currentDepth;							//depth of the nodes we're working with right now
-extern int currentLevelNodeCount;					//node count at the current level
-extern int nextLevelNodeCount;						//node count at the next level
+struct frontier searchFrontier;						//the current and next level of the traversal
 extern struct tree *treeRoot;						//root of the tree of board positions and moves
 extern struct treeNode *winner;						//winning node
 extern int endingSignal;
@@ -57,12 +56,14 @@ extern int endingSignal;
 **/
 int createRoot(int board[BOARDSIZE])
 {
-	long int rootHash;						//hash of the root of Yggdrasil
+	boardKey rootHash;						//hash of the root of Yggdrasil
 	struct treeNode *node;						//root node
 
 	createEmptyHashList();						//create a new hashList
 
-	rootHash = computeHashValue(board);				//compute the root's hash
+	initializeFrontier(&searchFrontier);				//and the two empty levels
+
+	rootHash = encodeBoard(board);				//compute the root's hash
 
 	if(rootHash == WINNINGHASH)
 	{
@@ -70,11 +71,11 @@ int createRoot(int board[BOARDSIZE])
 		return 1;
 	}
 
-	node = createNode(currentDepth, rootHash, board, 0, 0);
+	node = createNode(currentDepth, rootHash, board, findBlankIndex(board), 0, NOMOVE);
 
 	insertIntoYggdrasil(node, NULL);
 
-	enQueue(node);
+	appendNodes(&searchFrontier.current, &node, 1);
 
 	currentDepth = 0;
 
@@ -84,16 +85,17 @@ int createRoot(int board[BOARDSIZE])
 /**
 *Name: processNode
 *Purpose: This function will, given a node to process, run steps 5-8
-	of the above algorithm. It will find the x and y of the blank,
-	find how many moves are possible, the 1d indexes of the tiles we can
-	move in. Then, for every move we can make, it will copy the original board
-	into another variable to hold that node's board. Then, for each move we can,
-	it will swap the current index we can with the blank, then compute the hash value 
-	of that	new board. If that board is new, we will insert it as a child of the given
-	input node, if not, we won't bother making another node. We'll then check the hash,
+	of the above algorithm. It will look up how many moves are possible from
+	the node's blank position and the 1d indexes of the tiles we can move in
+	from the move tables in pathfinder.c, so nothing is allocated for them.
+	Then, for every move we can make, it will compute the hash value of
+	the board after that move straight from the current node's hash value, since
+	only the blank and the tile moving change. If that board is new, it will copy the
+	original board, swap the current index we can with the blank and insert it as a
+	child of the given input node, if not, we won't bother making another node. We'll then check the hash,
 	for a winning position, if it is a winning position, we'll return an int to signal that.
-	otherwise, we'll enqueue the newly made node and increment the counter for the number of
-	nodes on the next level.	
+	otherwise, we'll keep the newly made node, and once every move has been tried
+	we'll add all the new nodes to the next level of the frontier at once.	
 *Parameters: 
 	currentNode --current node to process
 *Returns:
@@ -103,32 +105,30 @@ int createRoot(int board[BOARDSIZE])
 int processNode(struct treeNode *currentNode)
 {
 	int blankIndex;								//index of the current blank position
-	int blankX;								//x coordinate of the blank
-	int blankY;								//y coordinate of the blank
 	int movesPossible;							//the number of moves possible from this position
-	char *moveDirections;							//character string of the move directions
-	int *indexesToSwap;							//1d indexes of the tiles we can move into the blank spot
+	const int *moveDirections;						//direction codes of the moves, from the move tables
+	const int *indexesToSwap;						//1d indexes of the tiles we can move into the blank spot
 	int i;									//loop control variable
 	int currentIndex;							//current index we are swapping in
-	long int hashVal;							//hash value of the board after the swap
+	boardKey hashVal;							//hash value of the board after the swap
 	int tileWeAreMoving;							//The actual value of the tile we are moving
 	struct treeNode *newNode;						//the next node we are going to insert
 	int lastNodeInsertedPosition;						//the index in the children array of the last node we
 										//inserted
 	int seenBeforeSignal;
+	struct treeNode *newChildren[MAXMOVES];					//new children to add to the next level
+	unsigned int newChildCount;						//number of entries in newChildren
 
 	lastNodeInsertedPosition = -1;
+	newChildCount = 0;
 
-	blankIndex = findBlankIndex(currentNode->board);
-
-	blankX = findX(blankIndex);
-	blankY = findY(blankIndex);
+	blankIndex = currentNode->blankIndex;
 
-	movesPossible = numberofMovesPossible(blankX, blankY);
+	movesPossible = movesForBlank[blankIndex];
 
-	moveDirections = findMoveDirections(movesPossible, blankX, blankY);
+	moveDirections = directionsForBlank[blankIndex];
 
-	indexesToSwap = tilesToMoveIn(movesPossible, blankX, blankY, moveDirections);
+	indexesToSwap = tilesForBlank[blankIndex];
 
 	for(i = 0; i < 	movesPossible; i++)
 	{
@@ -136,19 +136,21 @@ int processNode(struct treeNode *currentNode)
 
 		currentIndex = indexesToSwap[i];
 
-		memcpy(nodeBoardCopy, currentNode->board, sizeof(nodeBoardCopy));	
-
-		tileWeAreMoving = nodeBoardCopy[currentIndex];
-
-		swap(blankIndex, currentIndex, nodeBoardCopy);
-
-		hashVal = computeHashValue(nodeBoardCopy);
+		hashVal = applyMoveToKey(currentNode->hashVal, blankIndex, currentIndex);	//only two tiles change, so the
+												//child's key comes from ours
 
 		seenBeforeSignal = haveISeenThisPosition(hashVal);
 
 		if(seenBeforeSignal < 0)
 		{
-			newNode = createNode(currentDepth, hashVal, nodeBoardCopy, tileWeAreMoving, moveDirections[i]);
+			memcpy(nodeBoardCopy, currentNode->board, sizeof(nodeBoardCopy));
+
+			tileWeAreMoving = nodeBoardCopy[currentIndex];
+
+			swap(blankIndex, currentIndex, nodeBoardCopy);
+
+			newNode = createNode(currentDepth, hashVal, nodeBoardCopy, currentIndex, tileWeAreMoving,
+				moveDirections[i]);
 
 			lastNodeInsertedPosition = insertIntoYggdrasil(newNode, currentNode);
 
@@ -158,49 +160,47 @@ int processNode(struct treeNode *currentNode)
 			}	
 			else
 			{
-				enQueue(newNode);
-				nextLevelNodeCount++;
+				newChildren[newChildCount] = newNode;
+				newChildCount++;
 			}
 		}
 	}
+
+	appendNodes(&searchFrontier.next, newChildren, newChildCount);	//add all the children in one go
 	return -1;
 }
 
 /**
 *Name: processLevel
-*Purpose: This function will, given the number of nodes at this level,
-	will deQueue that many nodes from the queue and call processNode on them 
-	one at a time. It will wait for a return from processNode, if that return
-	is >= 0 that means we have found our winning hash and can stop. If it gets
-	all the way through that level and has not found a winner, it will move the second
-	node counter to equal the first and set the second to 0. Then increment currentDepth.
+*Purpose: This function will call processNode on every node of the current
+	level of the frontier, in order, one at a time. It will wait for a return
+	from processNode, if that return is >= 0 that means we have found our winning
+	hash and can stop. If it gets all the way through that level and has not found
+	a winner, it will make the next level the current one and increment currentDepth.
 *Parameters: 
-	nodesAtThisLevel --nodes at the this level, needed so we only deQueue that many nodes 
-	from the queue
+	winningPath --unused
 *Returns:
-	1 if we've won
+	the depth of the winning node if we've won
 	-1 if we have not
+	0 if the current level is empty, there is nothing left to search
 **/
-int processLevel(int nodesAtThisLevel, char *winningPath)
+int processLevel(char *winningPath)
 {
-	int nodesToProcess;					//nodes we need to process at this level
 	struct treeNode *currentNode;				//node we're processing right now
-	int i;							//loop control variable
+	unsigned int i;						//loop control variable
 	int haveIWon;						//integer to keep track of if we've won
 
 	haveIWon = -1;
 
-	nodesToProcess = nodesAtThisLevel;
+	if(searchFrontier.current.count == 0)
+	{
+		printf("I ran out of nodes\n");
+		return 0;
+	}
 
-	for(i = 0; i < nodesToProcess; i++)
+	for(i = 0; i < searchFrontier.current.count; i++)
 	{
-		currentNode = deQueue();
-		
-		if(currentNode == NULL)
-		{
-			printf("I ran out of nodes\n");
-			return 0;
-		}
+		currentNode = searchFrontier.current.nodes[i];
 
 		haveIWon = processNode(currentNode);
 
@@ -210,8 +210,7 @@ int processLevel(int nodesAtThisLevel, char *winningPath)
 			return currentNode->children[haveIWon]->depth;
 		}
 	}
-	currentLevelNodeCount = nextLevelNodeCount;
-	nextLevelNodeCount = 0;
+	advanceLevel(&searchFrontier);
 	currentDepth++;
 	return -1;
 }
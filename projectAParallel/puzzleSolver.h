@@ -16,9 +16,9 @@ AUTHORS:  Andrew Gendreau
 #include "hashList.h"
 #endif
 
-#ifndef QUEUE_H_
-#define QUEUE_H_
-#include "queue.h"
+#ifndef FRONTIER_H_
+#define FRONTIER_H_
+#include "frontier.h"
 #endif
 
 #ifndef PATH_H_
@@ -48,16 +48,17 @@ int createRoot(int board[BOARDSIZE]);
 /**
 *Name: processNode
 *Purpose: This function will, given a node to process, run steps 5-8
-	of the above algorithm. It will find the x and y of the blank,
-	find how many moves are possible, the 1d indexes of the tiles we can
-	move in. Then, for every move we can make, it will copy the original board
-	into another variable to hold that node's board. Then, for each move we can,
-	it will swap the current index we can with the blank, then compute the hash value 
-	of that	new board. If that board is new, we will insert it as a child of the given
-	input node, if not, we won't bother making another node. We'll then check the hash,
+	of the above algorithm. It will look up how many moves are possible from
+	the node's blank position and the 1d indexes of the tiles we can move in
+	from the move tables in pathfinder.c, so nothing is allocated for them.
+	Then, for every move we can make, it will compute the hash value of
+	the board after that move straight from the current node's hash value, since
+	only the blank and the tile moving change. If that board is new, it will copy the
+	original board, swap the current index we can with the blank and insert it as a
+	child of the given input node, if not, we won't bother making another node. We'll then check the hash,
 	for a winning position, if it is a winning position, we'll return an int to signal that.
-	otherwise, we'll enqueue the newly made node and increment the counter for the number of
-	nodes on the next level.	
+	otherwise, we'll keep the newly made node, and once every move has been tried
+	we'll add all the new nodes to the next level of the frontier at once.	
 *Parameters: 
 	currentNode --current node to process
 *Returns:
@@ -68,17 +69,16 @@ int processNode(struct treeNode *currentNode);
 
 /**
 *Name: processLevel
-*Purpose: This function will, given the number of nodes at this level,
-	will deQueue that many nodes from the queue and call processNode on them 
-	one at a time. It will wait for a return from processNode, if that return
-	is >= 0 that means we have found our winning hash and can stop. If it gets
-	all the way through that level and has not found a winner, it will move the second
-	node counter to equal the first and set the second to 0. Then increment currentDepth.
+*Purpose: This function will call processNode on every node of the current
+	level of the frontier, in order, one at a time. It will wait for a return
+	from processNode, if that return is >= 0 that means we have found our winning
+	hash and can stop. If it gets all the way through that level and has not found
+	a winner, it will make the next level the current one and increment currentDepth.
 *Parameters: 
-	nodesAtThisLevel --nodes at the this level, needed so we only deQueue that many nodes 
-	from the queue
+	winningPath --unused
 *Returns:
-	1 if we've won
+	the depth of the winning node if we've won
 	-1 if we have not
+	0 if the current level is empty, there is nothing left to search
 **/
-int processLevel(int nodesAtThisLevel, char *winningPath);
+int processLevel(char *winningPath);
@@ -6,8 +6,8 @@ PURPOSE: This module will be a tree to use to find the shortest path.
 	In each node of the tree, what will be stored will be:
 		-node depth (int)
 		-current board in 1d array form (array of ints)
-		-move made from the parent (character string of such form as: 4U (4 moved up)
-		-hash value of the board (long int)
+		-move made from the parent (a moveCode, formatMovePath writes it as 4U (4 moved up))
+		-hash value of the board (boardKey)
 		-Node ID: (hash value + node depth)
 		-Pointer to the parent
 		-Array of pointers to the children
@@ -62,9 +62,7 @@ struct tree *initializeMiniTree(struct treeNodeParentMPI newRootNode)
 	
 	newRoot = malloc(sizeof(struct tree));
 
-	newTreeNode = createNode(newRootNode.depth, newRootNode.hashVal, newRootNode.board, 0, 0);
-
-	strcpy(newTreeNode->moveFromParent, newRootNode.moveFromParent);
+	newTreeNode = createNode(newRootNode.depth, newRootNode.hashVal, newRootNode.board, findBlankIndex(newRootNode.board), 0, NOMOVE);
 
 	newRoot->root = newTreeNode;
 
@@ -99,45 +97,39 @@ void initializeTree(struct treeNode *newRootNode)
 /**
 *Name: createNode
 *Purpose: This function will, given a hash value, a node depth,
-	a board, the tile moved and the direction moved from the parent,
-	create that node and return a pointer to it.
+	a board, where the blank is on it, the tile moved and the direction
+	moved from the parent, create that node and return a pointer to it.
 *Parameters: 
 *	hashVal --hash value for a given board position.
 	depth --depth of this node
 	board --board of this node
+	blankIndex --1d index of the blank on board
 	tileMoved --the tile we've moved
-	directionMoved --the direction we moved
+	directionMoved --direction code of the move, NOMOVE for a root
 *Returns:
 	pointer to a new node
 **/
-struct treeNode *createNode(int depth, long int hashVal, int board[BOARDSIZE], int tileMoved, char directionMoved)
+struct treeNode *createNode(int depth, boardKey hashVal, int board[BOARDSIZE], int blankIndex, int tileMoved, int directionMoved)
 {
 	struct treeNode *newNode;						//new node to be returned
 	int i;									//loop control variable
-	char moveChar[2];							//character array to hold the char form of the tile we moved
-	char *move;								//string to hold the actual move, like 4U
-	char direction[2];							//char array to hold the direction we moved in
 
 	newNode = malloc(sizeof(struct treeNode));
 
 	newNode->hashVal = hashVal;
+	newNode->blankIndex = blankIndex;
 	newNode->depth = depth;
-	newNode->nodeID = hashVal + depth;
-	move = malloc(sizeof(char) * 4);					//because it will be a length 4 length string at max
+	newNode->nodeID = (int) (hashVal + depth);
 
 	memcpy(newNode->board, board, BOARDSIZE *sizeof(int));
 
 	if(tileMoved != 0)							//if we actually moved, if we're the root, tileMoved is 0
 	{
-		sprintf(moveChar, "%d", tileMoved);
-		sprintf(direction, "%c", directionMoved);
-		strcpy(move, moveChar);
-		strcat(move, direction);
-		strcpy(newNode->moveFromParent, move);
+		newNode->move = MOVECODE(tileMoved, directionMoved);		//only turned into text like 4U by formatMovePath
 	}
 	else
 	{
-		newNode->moveFromParent[0] = -1;
+		newNode->move = NOMOVECODE;
 	}
 
 	for(i = 0; i < MAXCHILDREN; i++)					//set the children array to NULL
@@ -165,7 +157,6 @@ struct treeNode *createNode(int depth, long int hashVal, int board[BOARDSIZE], i
 int insertIntoYggdrasil(struct treeNode *nodeToInsert, struct treeNode *nodeToBeParent)
 {
 		int i;							//loop control variable
-		struct treeNodeParentMPI *parentCopy;			//variable to hold an actual parentCopy value to use for MPI
 
 		if(nodeToBeParent == NULL)				//if we're inserting at the root
 		{
@@ -174,23 +165,7 @@ int insertIntoYggdrasil(struct treeNode *nodeToInsert, struct treeNode *nodeToBe
 		}
 		else
 		{
-			parentCopy = malloc(sizeof(struct treeNodeParentMPI));
-			memcpy(parentCopy->board, nodeToBeParent->board, sizeof(parentCopy->board));
-			parentCopy->hashVal = nodeToBeParent->hashVal;
-			parentCopy->depth = nodeToBeParent->depth;
-			
-			if(nodeToBeParent->moveFromParent[0] == -1)
-			{
-				//do nothing, there is no move to copy
-			}
-			else
-			{
-				strcpy(parentCopy->moveFromParent, nodeToBeParent->moveFromParent);
-			}
-			parentCopy->nodeID = nodeToBeParent->nodeID;
-
-			nodeToInsert->parent = nodeToBeParent;
-			nodeToInsert->parentCopy = *parentCopy;
+			nodeToInsert->parent = nodeToBeParent;		//parentCopy is only needed by a sent node, the master fills it then
 			i = 0;
 			while(nodeToBeParent->children[i] != NULL)
 			{
@@ -203,35 +178,45 @@ int insertIntoYggdrasil(struct treeNode *nodeToInsert, struct treeNode *nodeToBe
 }
 
 /**
-*Name: traverseWinningPath
-*Purpose: This function will, given a pointer to 
-	the winning node, traverse the tree up to the root and 
-	create a string to hold the moves made by appending the move in
-	node i to the result string in reverse.
+*Name: traceWinningPath
+*Purpose: This function will, given a pointer to the winning node,
+	walk the parent pointers up to the root of this Yggdrasil once
+	and fill path with the moves from the root to the winning node.
+	The moves are counted on the way up first, since what a node's
+	depth means depends on how the root was made, then a second walk
+	stores each move straight into its place.
 *Parameters: 
-*	winningNode --Node that had a hash of 0
+*	winningNode --Node that had the winning hash
+	path --path to fill
 *Returns:
-*	character pointer to the string that is the winning path
+	the number of moves on the path
+	-1 if the path is longer than MAXPATHLENGTH
 **/
-char *traverseWinningPath(struct treeNode *winningNode)
+int traceWinningPath(struct treeNode *winningNode, struct movePath *path)
 {
-	char *resultString;						//character string to hold the winning path
 	struct treeNode *currentNode;					//current node we are looking at
-	char *temp;							//tempory storage for the reverse append
+	int i;								//index in path of the current node's move
 
-	currentNode = winningNode;
-	
-	resultString = malloc(sizeof(char) * (2*winningNode->depth)); 
+	path->length = 0;
 
-	strcat(resultString, currentNode->moveFromParent);
+	for(currentNode = winningNode; currentNode != treeRoot->root; currentNode = currentNode->parent)
+	{
+		path->length++;
+	}
+
+	if(path->length > MAXPATHLENGTH)
+	{
+		path->length = 0;
+		return -1;
+	}
+
+	currentNode = winningNode;
 
-	while(currentNode->depth > treeRoot->root->depth)				//append until we hit the root
+	for(i = path->length - 1; i >= 0; i--)				//fill in until we hit the root
 	{
+		path->moves[i] = currentNode->move;
 		currentNode = currentNode->parent;
-		temp = strdup(resultString);
-		strcpy(resultString, currentNode->moveFromParent);
-		strcat(resultString, " ");
-		strcat(resultString, temp);
 	}
-return resultString;
+
+	return path->length;
 }
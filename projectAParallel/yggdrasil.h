@@ -6,7 +6,7 @@ PURPOSE: This module will be a tree to use to find the shortest path.
 	In each node of the tree, what will be stored will be:
 		-node depth (int)
 		-current board in 1d array form (array of ints)
-		-move made from the parent (character string of such form as: 4U (4 moved up)
+		-move made from the parent (a moveCode, formatMovePath writes it as 4U (4 moved up))
 		-hash value of the board (int)
 		-Node ID: (hash value + node depth)
 		-Pointer to the parent
@@ -34,6 +34,11 @@ AUTHORS:  Andrew Gendreau
 #include "hashList.h"
 #endif
 
+#ifndef MOVEPATH_H_
+#define MOVEPATH_H_
+#include "movePath.h"
+#endif
+
 #include <stdlib.h>
 
 #define MAXCHILDREN 4
@@ -50,22 +55,22 @@ AUTHORS:  Andrew Gendreau
 struct treeNodeParentMPI			//this is a definition I need simply to transfer the parent using an MPI datatype 
 {
 	int board[BOARDSIZE];
-	long int hashVal;
+	boardKey hashVal;
 	int depth;
-	char moveFromParent[4];
 	int nodeID;
 };
 
 struct treeNode 
 {
 	int board[BOARDSIZE];
-	long int hashVal;
+	boardKey hashVal;
+	int blankIndex;
 	int depth;
-	char moveFromParent[4];
+	moveCode move;
 	int nodeID;
 	struct treeNode *parent;
 	struct treeNode *children[MAXCHILDREN];
-	struct treeNodeParentMPI parentCopy;
+	struct treeNodeParentMPI parentCopy;			//only filled in by the master as it sends the node
 };
 
 struct tree
@@ -88,15 +93,16 @@ struct tree *initializeMiniTree(struct treeNodeParentMPI newRootNode);
 /**
 *Name: createNode
 *Purpose: This function will, given a hash value, a node depth,
-	and a board, create that node and return a pointer to it.
+	a board and where the blank is on it, create that node and return a pointer to it.
 *Parameters: 
 *	hashVal --hash value for a given board position.
 	depth --depth of this node
 	board --board of this node
+	blankIndex --1d index of the blank on board
 *Returns:
 	pointer to a new node
 **/
-struct treeNode *createNode(int depth, long int hashVal, int board[BOARDSIZE], int tileMoved, char directionMoved);
+struct treeNode *createNode(int depth, boardKey hashVal, int board[BOARDSIZE], int blankIndex, int tileMoved, int directionMoved);
 
 /**
 *Name: insertIntoYggdrasil
@@ -113,17 +119,21 @@ struct treeNode *createNode(int depth, long int hashVal, int board[BOARDSIZE], i
 int insertIntoYggdrasil(struct treeNode *nodeToInsert, struct treeNode *nodeToBeParent);
 
 /**
-*Name: traverseWinningPath
-*Purpose: This function will, given a pointer to 
-	the winning node, traverse the tree up to the root and 
-	create a string to hold the moves made by appending the move in
-	node i to the beginning of the current pathString.
+*Name: traceWinningPath
+*Purpose: This function will, given a pointer to the winning node,
+	walk the parent pointers up to the root of this Yggdrasil once
+	and fill path with the moves from the root to the winning node.
+	The moves are counted on the way up first, since what a node's
+	depth means depends on how the root was made, then a second walk
+	stores each move straight into its place.
 *Parameters: 
-*	winningNode --Node that had a hash of 0
+*	winningNode --Node that had the winning hash
+	path --path to fill
 *Returns:
-*	character pointer to the string that is the winning path
+	the number of moves on the path
+	-1 if the path is longer than MAXPATHLENGTH
 **/
-char *traverseWinningPath(struct treeNode *winningNode);
+int traceWinningPath(struct treeNode *winningNode, struct movePath *path);
 
 /**
 *Name: traverseSerialPath
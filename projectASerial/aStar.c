@@ -0,0 +1,523 @@
+/*NAME: aStar.c
+DATE: Oct 17th 2026
+VERSION: 1.0
+FILENAME: aStar.c
+PURPOSE: This module will be the A* engine. Iterative deepening A* keeps almost
+	nothing, but every pass expands again every board the passes before it did,
+	and it can not tell when two paths reach the same board. A* keeps every board
+	it has made, so each is expanded at most once, which pays for itself on the
+	boards in between what the breadth first search and iterative deepening A*
+	are each best at.
+	The open list is kept as an array of buckets, one for every value moves plus
+	estimate can take, since that is a small integer. A node is pushed on the
+	stack of its bucket and the next node to expand is popped off the lowest
+	bucket that is not empty, so both take constant time. Among nodes with the
+	same total the last one pushed goes first, which is usually the deepest, so
+	the search heads for the goal rather than widening out.
+	The nodes live in an arena like the breadth first search's, and a hash map
+	from the key of every board made to the index of its node is the closed set.
+	A board reached again by a shorter path gets a new node and the map is
+	pointed at it, the old node is skipped when it comes off the open list.
+	The estimate of a board is worked out once, when its parent is expanded,
+	from the parent's with the heuristic's update, and the parent's is worked
+	out again from its board, since only the key is kept in the node.
+	Most of the children A* stores are never expanded, since the search ends
+	before the open list gets down to their total. With aStarPartial set, the
+	search is partial expansion A*. A node is stored under a value that starts
+	as its own total. Expanding it makes only the children whose total is that
+	value or less, less when the estimate drops by more than the move made, as
+	the pattern databases' can. The node is then put back under the smallest total of the children
+	it held back, or closed if there are none. A child is only stored once the
+	search gets down to its total, so the ones it never gets to are never
+	stored. The price is working out every child's estimate again each time
+	its parent comes back off the open list.
+AUTHOR: Andrew Gendreau
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifndef ASTAR_H_
+#define ASTAR_H_
+#include "aStar.h"
+#endif
+
+#ifndef MEMORY_H_
+#define MEMORY_H_
+#include "memoryTracker.h"
+#endif
+
+#ifndef SEARCHLIMITS_H_
+#define SEARCHLIMITS_H_
+#include "searchLimits.h"
+#endif
+
+extern struct heuristic *idaHeuristic;						//lower bound the informed engines use
+
+struct nodeArena aStarNodes;							//every node made
+struct hashList *aStarSeen;							//key of every board made, mapped to the index of its best node
+struct openList aStarOpen;							//the open nodes, by moves plus estimate
+unsigned long long aStarExpanded;						//nodes expanded by the last solve
+unsigned long long aStarGenerated;						//nodes made by the last solve
+unsigned long long aStarRequeued;						//nodes put back on the open list by the last solve
+int aStarPartial = 0;								//1 to run partial expansion A*
+
+/**
+*Name: initializeOpenList
+*Purpose: This function will, given an open list and the number of priorities
+	it needs, set it up with an empty bucket for each of them.
+*Parameters:
+*	list --open list to set up
+	bucketCount --number of priorities, from 0 to bucketCount - 1
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void initializeOpenList(struct openList *list, int bucketCount)
+{
+	list->buckets = trackedCalloc(bucketCount, sizeof(struct openBucket));
+	list->bucketCount = bucketCount;
+	list->lowest = bucketCount;
+}
+
+/**
+*Name: pushOpen
+*Purpose: This function will, given an open list, a node index and its
+	priority, push it on the top of that bucket of the open list.
+*Parameters:
+*	list --open list to push on
+	nodeIndex --index of the node
+	priority --its priority, below the list's bucketCount
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void pushOpen(struct openList *list, unsigned int nodeIndex, int priority)
+{
+	struct openBucket *bucket;						//bucket the node goes in
+
+	bucket = &list->buckets[priority];
+
+	if(bucket->count == bucket->size)
+	{
+		if(bucket->size == 0)
+		{
+			bucket->nodes = trackedMalloc(INITIALBUCKETSIZE * sizeof(unsigned int));
+			bucket->size = INITIALBUCKETSIZE;
+		}
+		else
+		{
+			bucket->nodes = trackedRealloc(bucket->nodes, bucket->size * sizeof(unsigned int),
+				bucket->size * 2 * sizeof(unsigned int));
+			bucket->size = bucket->size * 2;
+		}
+	}
+
+	bucket->nodes[bucket->count] = nodeIndex;
+	bucket->count++;
+
+	if(priority < list->lowest)
+	{
+		list->lowest = priority;
+	}
+}
+
+/**
+*Name: popOpen
+*Purpose: This function will, given an open list, pop the node on the top of
+	its lowest bucket that is not empty.
+*Parameters:
+*	list --open list to pop from
+*Returns:
+	index of the node, the list's lowest is left at the bucket it came from
+	ROOTPARENT if the open list is empty
+*Author: Andrew Gendreau
+**/
+unsigned int popOpen(struct openList *list)
+{
+	struct openBucket *bucket;						//lowest bucket holding a node
+
+	while(list->lowest < list->bucketCount && list->buckets[list->lowest].count == 0)
+	{
+		list->lowest++;
+	}
+
+	if(list->lowest >= list->bucketCount)
+	{
+		return ROOTPARENT;
+	}
+
+	bucket = &list->buckets[list->lowest];
+	bucket->count--;
+
+	return bucket->nodes[bucket->count];
+}
+
+/**
+*Name: releaseOpenList
+*Purpose: This function will free the buckets of the given open list.
+*Parameters:
+*	list --open list to free
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void releaseOpenList(struct openList *list)
+{
+	int i;									//loop control variable
+
+	for(i = 0; i < list->bucketCount; i++)
+	{
+		trackedFree(list->buckets[i].nodes, list->buckets[i].size * sizeof(unsigned int));
+	}
+
+	trackedFree(list->buckets, list->bucketCount * sizeof(struct openBucket));
+	list->buckets = NULL;
+}
+
+/**
+*Name: addAStarNode
+*Purpose: This function will, given a board and how it was reached, add a node
+	for it to the arena, point the closed set at it and push it on the open list.
+*Parameters:
+*	key --key of the board
+	parent --index of the parent node, ROOTPARENT for the root
+	direction --direction code of the move from the parent, NOMOVE for the root
+	blankIndex --1d index of the blank on the board
+	moves --moves from the root to the board
+	estimate --lower bound on the moves left from it
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+static void addAStarNode(boardKey key, unsigned int parent, int direction, int blankIndex, int moves, int estimate)
+{
+	struct aStarNode *newNode;						//node being added
+	unsigned int index;							//index it will get
+
+	index = (unsigned int) aStarNodes.recordCount;
+
+	newNode = arenaAllocate(&aStarNodes);
+	newNode->key = key;
+	newNode->parent = parent;
+	newNode->direction = (unsigned char) direction;
+	newNode->blankIndex = (unsigned char) blankIndex;
+	newNode->moves = (unsigned char) moves;
+	newNode->stored = (unsigned char) (moves + estimate);
+
+	replacePositionValue(aStarSeen, key, index);
+	pushOpen(&aStarOpen, index, moves + estimate);
+	aStarGenerated++;
+}
+
+/**
+*Name: expandAStarNode
+*Purpose: This function will, given a node, make every child but the one that
+	undoes the node's own move. A child is added if its board has not been made
+	before, or only by a longer path, and if its total fits on the open list.
+	A node made before for the same board is closed. For partial expansion only
+	the children whose total is the node's stored value are added, and the node
+	is put back under the smallest total of the others. Otherwise, or if there
+	are no others, the node is closed.
+*Parameters:
+*	nodeIndex --index of the node to expand
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+static void expandAStarNode(unsigned int nodeIndex)
+{
+	struct aStarNode *currentNode;						//node we are expanding
+	struct aStarNode *oldNode;						//node already made for a child's board
+	struct heuristicState parentState;					//lower bound of the node's board
+	struct heuristicState childState;					//lower bound of a child's board
+	int board[BOARDSIZE];							//the node's board, changed for each child and put back
+	boardKey childKey;							//key of a child's board
+	unsigned int oldIndex;							//index of oldNode
+	int blankIndex;								//index of the blank on the node's board
+	int tileIndex;								//index of the tile being moved
+	int tile;								//the tile
+	int backwards;								//direction that would undo the move into the node
+	int moves;								//moves from the root to a child
+	int total;								//moves plus estimate of a child
+	int heldBack;								//smallest total of the children not added
+	int i;									//loop control variable
+
+	currentNode = arenaRecord(&aStarNodes, nodeIndex);
+	aStarExpanded++;
+	heldBack = MAXFVALUE + 1;
+
+	decodeBoard(currentNode->key, board);
+	idaHeuristic->evaluate(board, &parentState);
+
+	blankIndex = currentNode->blankIndex;
+	backwards = (currentNode->direction == (unsigned char) NOMOVE) ? NOMOVE : currentNode->direction ^ 1;
+	moves = currentNode->moves + 1;
+
+	if(moves > MAXPATHLENGTH)
+	{
+		currentNode->stored = CLOSEDNODE;
+		return;
+	}
+
+	for(i = 0; i < movesForBlank[blankIndex]; i++)
+	{
+		if(directionsForBlank[blankIndex][i] == backwards)
+		{
+			continue;
+		}
+
+		tileIndex = tilesForBlank[blankIndex][i];
+		childKey = applyMoveToKey(currentNode->key, blankIndex, tileIndex);
+		oldIndex = findPositionValue(aStarSeen, childKey);
+
+		if(oldIndex != NOPOSITIONVALUE)
+		{
+			oldNode = arenaRecord(&aStarNodes, oldIndex);
+
+			if(oldNode->moves <= moves)
+			{
+				continue;
+			}
+		}
+
+		tile = board[tileIndex];
+
+		board[blankIndex] = tile;						//make the move
+		board[tileIndex] = 0;
+
+		idaHeuristic->update(&parentState, &childState, board, tile, tileIndex, blankIndex);
+
+		board[tileIndex] = tile;						//and undo it
+		board[blankIndex] = 0;
+
+		total = moves + childState.value;
+
+		if(aStarPartial == 1 && total > currentNode->stored)
+		{
+			if(total < heldBack)
+			{
+				heldBack = total;
+			}
+			continue;
+		}
+
+		if(total <= MAXFVALUE)
+		{
+			if(oldIndex != NOPOSITIONVALUE)
+			{
+				oldNode->stored = CLOSEDNODE;
+			}
+
+			addAStarNode(childKey, nodeIndex, directionsForBlank[blankIndex][i], tileIndex, moves, childState.value);
+		}
+	}
+
+	if(heldBack <= MAXFVALUE)
+	{
+		currentNode->stored = (unsigned char) heldBack;
+		pushOpen(&aStarOpen, nodeIndex, heldBack);
+		aStarRequeued++;
+	}
+	else
+	{
+		currentNode->stored = CLOSEDNODE;
+	}
+}
+
+/**
+*Name: traceAStarPath
+*Purpose: This function will, given an arena of A* nodes and the winning node,
+	walk parent indices up to the root and fill path with the moves made from
+	the root to it.
+*Parameters:
+*	nodes --arena the nodes are in
+	nodeIndex --index of the winning node
+	path --path to fill
+*Returns:
+	the number of moves on the path
+*Author: Andrew Gendreau
+**/
+int traceAStarPath(struct nodeArena *nodes, unsigned int nodeIndex, struct movePath *path)
+{
+	struct aStarNode *currentNode;						//node we are looking at
+	struct aStarNode *parentNode;						//its parent
+
+	currentNode = arenaRecord(nodes, nodeIndex);
+	path->length = currentNode->moves;
+
+	while(currentNode->parent != ROOTPARENT)
+	{
+		parentNode = arenaRecord(nodes, currentNode->parent);
+		path->moves[currentNode->moves - 1] = MOVECODE(KEYTILE(currentNode->key, parentNode->blankIndex),
+			currentNode->direction);
+		currentNode = parentNode;
+	}
+
+	return path->length;
+}
+
+/**
+*Name: aStarSolve
+*Purpose: This function will, given a solvable board, find a shortest path to
+	the winning state with A*, always expanding an open node with the smallest
+	moves plus estimate, until the winning board is taken off the open list.
+	A node that comes off the open list after its board was reached again by a
+	shorter path, or from a bucket it is no longer stored under, is skipped.
+	The pattern databases are not consistent, an estimate can drop by more
+	than the one move made, so a board can be expanded before its shortest
+	path is found. A board reached again by a shorter path is opened again,
+	even if it was expanded, so with every heuristic here never overestimating
+	the first time the winning board comes off the open list its path is a
+	shortest one.
+	If aStarPartial is 1 a node only makes the children whose total is at most
+	the value it is stored under, and is put back under the smallest total of
+	the rest, so children that would never be expanded are never stored.
+	The search limits are charged every LIMITCHECKNODES nodes and every time
+	the smallest total on the open list goes up, and no path is shorter than
+	that total when one stops it.
+*Parameters:
+*	board --1d array containing the game board
+	path --path to fill
+*Returns:
+	the number of moves on the path
+	-1 if there is no path of MAXPATHLENGTH moves or fewer
+	LIMITREACHED if a search limit was reached
+*Author: Andrew Gendreau
+**/
+int aStarSolve(int board[BOARDSIZE], struct movePath *path)
+{
+	struct heuristicState rootState;					//lower bound of the root board
+	struct aStarNode *currentNode;						//node taken off the open list
+	unsigned int nodeIndex;							//its index
+	unsigned int sinceCharge;						//nodes expanded since the limits were last charged
+	int bound;								//smallest total on the open list when they were
+	int length;								//length of the path found
+
+	if(idaHeuristic == NULL)
+	{
+		idaHeuristic = findHeuristic("manhattan");
+	}
+
+	initializeArena(&aStarNodes, sizeof(struct aStarNode), NODESPERCHUNK);
+	aStarSeen = createHashMap(INITIALHASHCAPACITY);
+	initializeOpenList(&aStarOpen, MAXFVALUE + 1);
+	aStarExpanded = 0;
+	aStarGenerated = 0;
+	aStarRequeued = 0;
+
+	idaHeuristic->evaluate(board, &rootState);
+	addAStarNode(encodeBoard(board), ROOTPARENT, NOMOVE, findBlankIndex(board), 0, rootState.value);
+
+	length = -1;
+	path->length = 0;
+	sinceCharge = 0;
+	bound = -1;
+
+	for(nodeIndex = popOpen(&aStarOpen); nodeIndex != ROOTPARENT; nodeIndex = popOpen(&aStarOpen))
+	{
+		currentNode = arenaRecord(&aStarNodes, nodeIndex);
+
+		if(currentNode->stored != aStarOpen.lowest)
+		{
+			continue;
+		}
+
+		if(currentNode->key == WINNINGHASH)
+		{
+			length = traceAStarPath(&aStarNodes, nodeIndex, path);
+			break;
+		}
+
+		if(aStarOpen.lowest != bound || sinceCharge == LIMITCHECKNODES)
+		{
+			bound = aStarOpen.lowest;
+
+			if(chargeSearchLimits(sinceCharge, bound) != LIMITNONE)
+			{
+				length = stopAtLimit(bound);
+				break;
+			}
+
+			sinceCharge = 0;
+		}
+
+		expandAStarNode(nodeIndex);
+		sinceCharge++;
+	}
+
+	releaseOpenList(&aStarOpen);
+	releaseArena(&aStarNodes);
+	destroyHashList(aStarSeen);
+
+	return length;
+}
+
+/**
+*Name: runAStar
+*Purpose: This function will, given a 1d array that represents the inital board state,
+	solve it with aStarSolve and print the length of the path, its moves, how many
+	nodes were expanded and made and the most heap held at once, or the search
+	limit that stopped it.
+*Parameters:
+	board --1d Int array to hold the root board
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void runAStar(int board[BOARDSIZE])
+{
+	struct movePath winningPath;						//the moves from the root to the goal
+	char winningMoves[PATHTEXTSIZE];					//text of those moves
+	int length;								//what the solve returned
+
+	if(givenAWinner(encodeBoard(board)) == 1)
+	{
+		return;
+	}
+
+	length = aStarSolve(board, &winningPath);
+
+	if(length == LIMITREACHED)
+	{
+		reportSearchLimit();
+		printf("Expanded %llu nodes and made %llu\n", aStarExpanded, aStarGenerated);
+		printf("Peak heap use was %lu bytes\n", (unsigned long) memoryUsage.peakBytes);
+		return;
+	}
+
+	if(length < 0)
+	{
+		printf("There is no solution in %d moves or fewer\n", MAXPATHLENGTH);
+		return;
+	}
+
+	formatMovePath(&winningPath, winningMoves);
+
+	printf("It took %d moves\n", winningPath.length);
+	printf("The moves were: %s\n", winningMoves);
+	printf("Expanded %llu nodes and made %llu\n", aStarExpanded, aStarGenerated);
+
+	if(aStarPartial == 1)
+	{
+		printf("Put %llu nodes back on the open list\n", aStarRequeued);
+	}
+
+	printf("Peak heap use was %lu bytes\n", (unsigned long) memoryUsage.peakBytes);
+}
+
+/**
+*Name: runPartialAStar
+*Purpose: This function will, given a 1d array that represents the inital board state,
+	run runAStar on it with partial expansion turned on.
+*Parameters:
+	board --1d Int array to hold the root board
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void runPartialAStar(int board[BOARDSIZE])
+{
+	aStarPartial = 1;
+	runAStar(board);
+}
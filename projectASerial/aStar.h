@@ -0,0 +1,176 @@
+/*NAME: aStar.h
+DATE: Oct 17th 2026
+VERSION: 1.0
+FILENAME: aStar.h
+PURPOSE: This is a header for aStar.c
+AUTHOR: Andrew Gendreau
+*/
+
+#ifndef SOLVER_H_
+#define SOLVER_H_
+#include "puzzleSolver.h"
+#endif
+
+#ifndef HEURISTIC_H_
+#define HEURISTIC_H_
+#include "heuristic.h"
+#endif
+
+#define MAXFVALUE (2 * MAXPATHLENGTH)				//largest moves plus estimate the open list has a bucket for
+#define INITIALBUCKETSIZE 64					//nodes a bucket has room for when it is first used
+#define CLOSEDNODE 0xFF						//stored value of a node that will not be expanded again
+
+/*
+	This is a struct for one node of the A* search, packed into 16 bytes like
+	a searchNode. The moves from the root are kept so a board reached again by
+	a shorter path can be told apart from one that is not. The stored value is
+	the bucket of the open list the node is waiting in, so a copy of its index
+	found in any other bucket is out of date.
+*/
+struct aStarNode
+{
+	boardKey key;						//the board of this node
+	unsigned int parent;					//index of the parent node, ROOTPARENT for the root
+	unsigned char direction;				//direction code of the move from the parent, NOMOVE for the root
+	unsigned char blankIndex;				//1d index of the blank on this board
+	unsigned char moves;					//moves from the root to this board
+	unsigned char stored;					//moves plus estimate it is open under, CLOSEDNODE once it is not open
+};
+
+/*
+	This is a struct for one bucket of the open list, every open node with the
+	same moves plus estimate, as a stack of node indices.
+*/
+struct openBucket
+{
+	unsigned int *nodes;					//indices of the nodes
+	unsigned long count;					//number of them
+	unsigned long size;					//number there is room for
+};
+
+/*
+	This is a struct for an open list, a bucket for every priority from 0 to
+	bucketCount - 1. The next node to expand is on the top of the lowest
+	bucket that is not empty.
+*/
+struct openList
+{
+	struct openBucket *buckets;				//the buckets, by priority
+	int bucketCount;					//number of them
+	int lowest;						//no bucket below this one holds a node
+};
+
+/**
+*Name: initializeOpenList
+*Purpose: This function will, given an open list and the number of priorities
+	it needs, set it up with an empty bucket for each of them.
+*Parameters:
+*	list --open list to set up
+	bucketCount --number of priorities, from 0 to bucketCount - 1
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void initializeOpenList(struct openList *list, int bucketCount);
+
+/**
+*Name: pushOpen
+*Purpose: This function will, given an open list, a node index and its
+	priority, push it on the top of that bucket of the open list.
+*Parameters:
+*	list --open list to push on
+	nodeIndex --index of the node
+	priority --its priority, below the list's bucketCount
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void pushOpen(struct openList *list, unsigned int nodeIndex, int priority);
+
+/**
+*Name: popOpen
+*Purpose: This function will, given an open list, pop the node on the top of
+	its lowest bucket that is not empty.
+*Parameters:
+*	list --open list to pop from
+*Returns:
+	index of the node, the list's lowest is left at the bucket it came from
+	ROOTPARENT if the open list is empty
+*Author: Andrew Gendreau
+**/
+unsigned int popOpen(struct openList *list);
+
+/**
+*Name: releaseOpenList
+*Purpose: This function will free the buckets of the given open list.
+*Parameters:
+*	list --open list to free
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void releaseOpenList(struct openList *list);
+
+/**
+*Name: traceAStarPath
+*Purpose: This function will, given an arena of A* nodes and the winning node,
+	walk parent indices up to the root and fill path with the moves made from
+	the root to it.
+*Parameters:
+*	nodes --arena the nodes are in
+	nodeIndex --index of the winning node
+	path --path to fill
+*Returns:
+	the number of moves on the path
+*Author: Andrew Gendreau
+**/
+int traceAStarPath(struct nodeArena *nodes, unsigned int nodeIndex, struct movePath *path);
+
+/**
+*Name: aStarSolve
+*Purpose: This function will, given a solvable board, find a shortest path to
+	the winning state with A*, always expanding an open node with the smallest
+	moves plus estimate, until the winning board is taken off the open list.
+	A board reached again by a shorter path is opened again, since the
+	pattern databases are not consistent.
+	If aStarPartial is 1 a node only makes the children whose total is at most
+	the value it is stored under, and is put back under the smallest total of
+	the rest, so children that would never be expanded are never stored.
+	No path is shorter than the smallest total on the open list when a
+	search limit stops it.
+*Parameters:
+*	board --1d array containing the game board
+	path --path to fill
+*Returns:
+	the number of moves on the path
+	-1 if there is no path of MAXPATHLENGTH moves or fewer
+	LIMITREACHED if a search limit was reached
+*Author: Andrew Gendreau
+**/
+int aStarSolve(int board[BOARDSIZE], struct movePath *path);
+
+/**
+*Name: runAStar
+*Purpose: This function will, given a 1d array that represents the inital board state,
+	solve it with aStarSolve and print the length of the path, its moves, how many
+	nodes were expanded and made and the most heap held at once, or the search
+	limit that stopped it.
+*Parameters:
+	board --1d Int array to hold the root board
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void runAStar(int board[BOARDSIZE]);
+
+/**
+*Name: runPartialAStar
+*Purpose: This function will, given a 1d array that represents the inital board state,
+	run runAStar on it with partial expansion turned on.
+*Parameters:
+	board --1d Int array to hold the root board
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void runPartialAStar(int board[BOARDSIZE]);
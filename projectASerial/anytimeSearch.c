@@ -0,0 +1,520 @@
+/*NAME: anytimeSearch.c
+DATE: Oct 17th 2026
+VERSION: 1.0
+FILENAME: anytimeSearch.c
+PURPOSE: This module will be the anytime engine, for when a path is wanted
+	within a deadline and one a little longer than the shortest will do.
+	It is anytime weighted A*. The open list is ordered by moves plus weight
+	times estimate, which with a weight above one heads for the goal and
+	finds a path long before A* would. The search does not stop there. It
+	takes WEIGHTSTEP off the weight, orders the open list again by the new
+	weight and carries on from where it was, keeping every node it has made.
+	Every shorter path found takes the weight down again, until it is one
+	and the search is plain A*. Nodes whose moves plus estimate can not beat
+	the shortest path found so far are dropped, and a board reached again by
+	a shorter path gets a new node that is opened again, even if the old one
+	had been expanded, since with a weight above one it may have been
+	expanded before its shortest path was found.
+	A count of the open nodes with each moves plus estimate is kept, so the
+	smallest of them can be found at any time. No path can be shorter than
+	that or than the path found, so the path found is at most its length
+	over that many times as long as a shortest one. When the open list runs
+	out the path found is a shortest one.
+	The nodes, the open list and the closed map are the same as A*'s.
+AUTHOR: Andrew Gendreau
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifndef ANYTIMESEARCH_H_
+#define ANYTIMESEARCH_H_
+#include "anytimeSearch.h"
+#endif
+
+#ifndef MEMORY_H_
+#define MEMORY_H_
+#include "memoryTracker.h"
+#endif
+
+#ifndef SEARCHLIMITS_H_
+#define SEARCHLIMITS_H_
+#include "searchLimits.h"
+#endif
+
+extern struct heuristic *idaHeuristic;						//lower bound the informed engines use
+
+int anytimeDeadline = DEFAULTDEADLINE;						//milliseconds the search runs for
+int anytimeStartWeight = DEFAULTSTARTWEIGHT;					//weight it starts with, in tenths
+int anytimeWeight;								//weight it is running with, in tenths
+int anytimeLastWeight;								//weight the last path was found with, in tenths
+int anytimeLowerBound;								//fewest moves any path can have
+int anytimeSolutions;								//paths found by the last solve, each shorter than the one before
+unsigned long long anytimeExpanded;						//nodes expanded by the last solve
+double anytimeMilliseconds;							//milliseconds the last solve ran for
+double anytimeFirstPath;							//milliseconds it took to find its first path
+
+struct nodeArena anytimeNodes;							//every node made
+struct hashList *anytimeSeen;							//key of every board made, mapped to the index of its best node
+struct openList anytimeOpen;							//the open nodes, by moves plus weight times estimate
+unsigned long openTotals[MAXFVALUE + 1];					//number of open nodes with each moves plus estimate
+
+/**
+*Name: millisecondsSince
+*Purpose: This function will, given a time read from the monotonic clock,
+	return how many milliseconds have passed since.
+*Parameters:
+*	start --the time to measure from
+*Returns:
+	the milliseconds since start
+*Author: Andrew Gendreau
+**/
+static double millisecondsSince(struct timespec *start)
+{
+	struct timespec now;							//current time
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (now.tv_sec - start->tv_sec) * 1000.0 + (now.tv_nsec - start->tv_nsec) / 1000000.0;
+}
+
+/**
+*Name: estimateOf
+*Purpose: This function will, given a node, work its estimate out again from
+	its board, since only the key is kept in the node.
+*Parameters:
+*	node --node to estimate
+	state --lower bound to fill
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+static void estimateOf(struct aStarNode *node, struct heuristicState *state)
+{
+	int board[BOARDSIZE];							//the node's board
+
+	decodeBoard(node->key, board);
+	idaHeuristic->evaluate(board, state);
+}
+
+/**
+*Name: isOpen
+*Purpose: This function will, given a node index, check if it is a node on
+	the open list, which it is not once it has been expanded or dropped, or
+	once its board has been reached by a shorter path.
+*Parameters:
+*	nodeIndex --index of the node
+*Returns:
+	1 if it is open
+	0 if it is not
+*Author: Andrew Gendreau
+**/
+static int isOpen(unsigned int nodeIndex)
+{
+	struct aStarNode *node;							//the node
+
+	node = arenaRecord(&anytimeNodes, nodeIndex);
+
+	if(node->stored != OPENNODE || findPositionValue(anytimeSeen, node->key) != nodeIndex)
+	{
+		return 0;
+	}
+
+	return 1;
+}
+
+/**
+*Name: reorderOpen
+*Purpose: This function will move every node on the open list to a new open
+	list ordered by anytimeWeight, dropping the out of date entries, and put
+	the new list in place of the old.
+*Parameters:
+*	void
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+static void reorderOpen(void)
+{
+	struct openList reordered;						//the open list by the new weight
+	struct openBucket *bucket;						//bucket being moved
+	struct aStarNode *node;							//node being moved
+	struct heuristicState state;						//its lower bound
+	unsigned long n;							//entry of the bucket being moved
+	int b;									//loop control variable
+
+	initializeOpenList(&reordered, anytimeOpen.bucketCount);
+
+	for(b = anytimeOpen.lowest; b < anytimeOpen.bucketCount; b++)
+	{
+		bucket = &anytimeOpen.buckets[b];
+
+		for(n = 0; n < bucket->count; n++)
+		{
+			if(isOpen(bucket->nodes[n]) == 0)
+			{
+				continue;
+			}
+
+			node = arenaRecord(&anytimeNodes, bucket->nodes[n]);
+			estimateOf(node, &state);
+			pushOpen(&reordered, bucket->nodes[n], WEIGHTSCALE * node->moves + anytimeWeight * state.value);
+		}
+	}
+
+	releaseOpenList(&anytimeOpen);
+	anytimeOpen = reordered;
+}
+
+/**
+*Name: addAnytimeNode
+*Purpose: This function will, given a board and how it was reached, add an
+	open node for it, point the closed map at it, count its moves plus
+	estimate and push it on the open list by the current weight.
+*Parameters:
+*	key --key of the board
+	parent --index of the parent node, ROOTPARENT for the root
+	direction --direction code of the move from the parent, NOMOVE for the root
+	blankIndex --1d index of the blank on the board
+	moves --moves from the root to the board
+	estimate --lower bound on the moves left from it
+*Returns:
+	index of the node
+*Author: Andrew Gendreau
+**/
+static unsigned int addAnytimeNode(boardKey key, unsigned int parent, int direction, int blankIndex,
+	int moves, int estimate)
+{
+	struct aStarNode *newNode;						//node being added
+	unsigned int index;							//index it will get
+
+	index = (unsigned int) anytimeNodes.recordCount;
+
+	newNode = arenaAllocate(&anytimeNodes);
+	newNode->key = key;
+	newNode->parent = parent;
+	newNode->direction = (unsigned char) direction;
+	newNode->blankIndex = (unsigned char) blankIndex;
+	newNode->moves = (unsigned char) moves;
+	newNode->stored = OPENNODE;
+
+	replacePositionValue(anytimeSeen, key, index);
+	openTotals[moves + estimate]++;
+	pushOpen(&anytimeOpen, index, WEIGHTSCALE * moves + anytimeWeight * estimate);
+
+	return index;
+}
+
+/**
+*Name: expandAnytimeNode
+*Purpose: This function will, given a node and the length of the shortest path
+	found so far, make every child but the one that undoes the node's own move
+	and add the ones that could be on a shorter path and whose boards have not
+	been reached by a path as short. An open node made before for the same
+	board is closed. A child that is the winning board shortens the path.
+*Parameters:
+*	nodeIndex --index of the node to expand
+	parentState --lower bound of its board
+	board --its board
+	best --the length of the shortest path found so far
+	path --that path, replaced if a shorter one is found
+*Returns:
+	the length of the shortest path found, best if none was shorter
+*Author: Andrew Gendreau
+**/
+static int expandAnytimeNode(unsigned int nodeIndex, struct heuristicState *parentState, int board[BOARDSIZE],
+	int best, struct movePath *path)
+{
+	struct aStarNode *currentNode;						//node we are expanding
+	struct aStarNode *oldNode;						//node already made for a child's board
+	struct heuristicState childState;					//lower bound of a child's board
+	boardKey childKey;							//key of a child's board
+	unsigned int oldIndex;							//index of oldNode
+	unsigned int childIndex;						//index of the child's node
+	int blankIndex;								//index of the blank on the node's board
+	int tileIndex;								//index of the tile being moved
+	int tile;								//the tile
+	int backwards;								//direction that would undo the move into the node
+	int moves;								//moves from the root to a child
+	int i;									//loop control variable
+
+	currentNode = arenaRecord(&anytimeNodes, nodeIndex);
+	anytimeExpanded++;
+
+	blankIndex = currentNode->blankIndex;
+	backwards = (currentNode->direction == (unsigned char) NOMOVE) ? NOMOVE : currentNode->direction ^ 1;
+	moves = currentNode->moves + 1;
+
+	for(i = 0; i < movesForBlank[blankIndex]; i++)
+	{
+		if(directionsForBlank[blankIndex][i] == backwards)
+		{
+			continue;
+		}
+
+		tileIndex = tilesForBlank[blankIndex][i];
+		childKey = applyMoveToKey(currentNode->key, blankIndex, tileIndex);
+		oldIndex = findPositionValue(anytimeSeen, childKey);
+		oldNode = NULL;
+
+		if(oldIndex != NOPOSITIONVALUE)
+		{
+			oldNode = arenaRecord(&anytimeNodes, oldIndex);
+
+			if(oldNode->moves <= moves)
+			{
+				continue;
+			}
+		}
+
+		tile = board[tileIndex];
+
+		board[blankIndex] = tile;						//make the move
+		board[tileIndex] = 0;
+
+		idaHeuristic->update(parentState, &childState, board, tile, tileIndex, blankIndex);
+
+		board[tileIndex] = tile;						//and undo it
+		board[blankIndex] = 0;
+
+		if(moves + childState.value >= best)
+		{
+			continue;
+		}
+
+		if(oldNode != NULL && oldNode->stored == OPENNODE)
+		{
+			openTotals[oldNode->moves + childState.value]--;
+			oldNode->stored = CLOSEDNODE;
+		}
+
+		childIndex = addAnytimeNode(childKey, nodeIndex, directionsForBlank[blankIndex][i], tileIndex,
+			moves, childState.value);
+
+		if(childKey == WINNINGHASH)
+		{
+			best = traceAStarPath(&anytimeNodes, childIndex, path);
+			anytimeSolutions++;
+		}
+	}
+
+	return best;
+}
+
+/**
+*Name: anytimeSolve
+*Purpose: This function will, given a solvable board, find a path to the
+	winning state with anytime weighted A*, and keep shortening it until
+	anytimeDeadline milliseconds have passed or it is proven a shortest one.
+	The search starts with anytimeStartWeight on the estimate and takes
+	WEIGHTSTEP off every time it finds a shorter path, reusing every node it
+	has made. If there is no path by the deadline it runs on to the first.
+	A node taken off the open list is closed, and expanded unless its moves
+	plus estimate can not beat the path found. The clock is read every
+	DEADLINECHECKNODES nodes.
+	The search limits are charged then too, and one that is reached stops the
+	search like the deadline, even before a path is found. A depth limit is
+	kept by starting the search as if a path one move longer had been found.
+*Parameters:
+*	board --1d array containing the game board
+	path --path to fill with the shortest path found
+*Returns:
+	the number of moves on the path, anytimeLowerBound is left at the fewest
+	moves any path can have
+	-1 if there is no path of MAXPATHLENGTH moves or fewer
+	LIMITREACHED if a search limit was reached before a path was found
+*Author: Andrew Gendreau
+**/
+int anytimeSolve(int board[BOARDSIZE], struct movePath *path)
+{
+	struct timespec start;							//time the search started
+	struct heuristicState state;						//lower bound of the board being expanded
+	struct aStarNode *currentNode;						//node taken off the open list
+	int currentBoard[BOARDSIZE];						//its board
+	unsigned int nodeIndex;							//its index
+	unsigned long long taken;						//nodes taken off the open list
+	int best;								//length of the shortest path found, cutoff for none
+	int cutoff;								//one more than the longest path looked for
+	int shorter;								//length of the path found by an expansion
+	int total;								//moves plus estimate of the node
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+
+	if(idaHeuristic == NULL)
+	{
+		idaHeuristic = findHeuristic("manhattan");
+	}
+
+	initializeArena(&anytimeNodes, sizeof(struct aStarNode), NODESPERCHUNK);
+	anytimeSeen = createHashMap(INITIALHASHCAPACITY);
+	initializeOpenList(&anytimeOpen, (WEIGHTSCALE + anytimeStartWeight) * MAXPATHLENGTH + 1);
+	memset(openTotals, 0, sizeof(openTotals));
+	anytimeWeight = anytimeStartWeight;
+	anytimeLastWeight = anytimeStartWeight;
+	anytimeSolutions = 0;
+	anytimeFirstPath = 0;
+	anytimeExpanded = 0;
+	taken = 0;
+	cutoff = MAXPATHLENGTH + 1;
+
+	if(searchLimits.maxDepth > 0 && searchLimits.maxDepth < MAXPATHLENGTH)
+	{
+		cutoff = searchLimits.maxDepth + 1;
+	}
+
+	best = cutoff;
+	path->length = 0;
+
+	idaHeuristic->evaluate(board, &state);
+	addAnytimeNode(encodeBoard(board), ROOTPARENT, NOMOVE, findBlankIndex(board), 0, state.value);
+
+	for(nodeIndex = popOpen(&anytimeOpen); nodeIndex != ROOTPARENT; nodeIndex = popOpen(&anytimeOpen))
+	{
+		taken++;
+
+		if(taken % DEADLINECHECKNODES == 0 && (chargeSearchLimits(DEADLINECHECKNODES, 0) != LIMITNONE
+			|| (best < cutoff && millisecondsSince(&start) >= anytimeDeadline)))
+		{
+			break;								//the node is still counted as open
+		}
+
+		if(isOpen(nodeIndex) == 0)
+		{
+			continue;
+		}
+
+		currentNode = arenaRecord(&anytimeNodes, nodeIndex);
+		decodeBoard(currentNode->key, currentBoard);
+		idaHeuristic->evaluate(currentBoard, &state);
+		total = currentNode->moves + state.value;
+
+		currentNode->stored = CLOSEDNODE;
+		openTotals[total]--;
+
+		if(total >= best)
+		{
+			continue;
+		}
+
+		shorter = expandAnytimeNode(nodeIndex, &state, currentBoard, best, path);
+
+		if(shorter < best)
+		{
+			if(best == cutoff)
+			{
+				anytimeFirstPath = millisecondsSince(&start);
+			}
+
+			best = shorter;
+			anytimeLastWeight = anytimeWeight;				//before it is lowered for the next one
+
+			if(anytimeWeight > WEIGHTSCALE)
+			{
+				anytimeWeight = anytimeWeight - WEIGHTSTEP < WEIGHTSCALE ? WEIGHTSCALE : anytimeWeight - WEIGHTSTEP;
+				reorderOpen();
+			}
+		}
+	}
+
+	for(anytimeLowerBound = 0; anytimeLowerBound < best && openTotals[anytimeLowerBound] == 0; anytimeLowerBound++)
+	{
+	}
+
+	anytimeMilliseconds = millisecondsSince(&start);
+
+	releaseOpenList(&anytimeOpen);
+	releaseArena(&anytimeNodes);
+	destroyHashList(anytimeSeen);
+
+	if(best == cutoff && cutoff <= MAXPATHLENGTH && nodeIndex == ROOTPARENT)
+	{
+		chargeSearchLimits(0, cutoff);					//every path within the depth limit was ruled out
+	}
+
+	if(best == cutoff && atomic_load(&limitHit) != LIMITNONE)
+	{
+		return stopAtLimit(anytimeLowerBound);
+	}
+
+	if(best == cutoff)
+	{
+		return -1;
+	}
+
+	return best;
+}
+
+/**
+*Name: runAnytime
+*Purpose: This function will, given a 1d array that represents the inital board state,
+	solve it with anytimeSolve and print the length of the path, its moves, how far
+	from a shortest path it can be, how many paths were found and the weight of the
+	last, how many nodes were expanded and the most heap held at once, and the
+	search limit that stopped it if one did.
+*Parameters:
+	board --1d Int array to hold the root board
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void runAnytime(int board[BOARDSIZE])
+{
+	struct movePath winningPath;						//the moves from the root to the goal
+	char winningMoves[PATHTEXTSIZE];					//text of those moves
+	int length;								//what the solve returned
+
+	if(givenAWinner(encodeBoard(board)) == 1)
+	{
+		return;
+	}
+
+	length = anytimeSolve(board, &winningPath);
+
+	if(length == LIMITREACHED)
+	{
+		reportSearchLimit();
+		printf("Expanded %llu nodes\n", anytimeExpanded);
+		printf("Peak heap use was %lu bytes\n", (unsigned long) memoryUsage.peakBytes);
+		return;
+	}
+
+	if(length < 0)
+	{
+		printf("There is no solution in %d moves or fewer\n", MAXPATHLENGTH);
+		return;
+	}
+
+	formatMovePath(&winningPath, winningMoves);
+
+	printf("It took %d moves\n", winningPath.length);
+	printf("The moves were: %s\n", winningMoves);
+
+	if(anytimeLowerBound == winningPath.length)
+	{
+		printf("That is a shortest path\n");
+	}
+	else
+	{
+		printf("That is at most %.3f times the shortest, which is at least %d moves\n",
+			(double) winningPath.length / anytimeLowerBound, anytimeLowerBound);
+	}
+
+	printf("Found %d paths in %.3f milliseconds, the last with weight %.1f\n", anytimeSolutions,
+		anytimeMilliseconds, (double) anytimeLastWeight / WEIGHTSCALE);
+
+	if(anytimeFirstPath > anytimeDeadline)
+	{
+		printf("The deadline of %d milliseconds had passed before the first path was found\n", anytimeDeadline);
+	}
+
+	if(atomic_load(&limitHit) != LIMITNONE)
+	{
+		stopAtLimit(anytimeLowerBound);
+		reportSearchLimit();
+	}
+
+	printf("Expanded %llu nodes\n", anytimeExpanded);
+	printf("Peak heap use was %lu bytes\n", (unsigned long) memoryUsage.peakBytes);
+}
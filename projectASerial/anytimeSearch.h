@@ -0,0 +1,56 @@
+/*NAME: anytimeSearch.h
+DATE: Oct 17th 2026
+VERSION: 1.0
+FILENAME: anytimeSearch.h
+PURPOSE: This is a header for anytimeSearch.c
+AUTHOR: Andrew Gendreau
+*/
+
+#ifndef ASTAR_H_
+#define ASTAR_H_
+#include "aStar.h"
+#endif
+
+#define WEIGHTSCALE 10						//weights are kept in tenths
+#define DEFAULTSTARTWEIGHT 30					//weight on the estimate the search starts with, 3.0
+#define MAXSTARTWEIGHT 100					//largest weight it can start with, 10.0
+#define WEIGHTSTEP 5						//taken off the weight every time a shorter path is found
+#define DEFAULTDEADLINE 10					//milliseconds the search runs for if -d is not given
+#define DEADLINECHECKNODES 256					//nodes taken off the open list between reads of the clock
+#define OPENNODE 0						//stored value of a node that is on the open list
+
+/**
+*Name: anytimeSolve
+*Purpose: This function will, given a solvable board, find a path to the
+	winning state with anytime weighted A*, and keep shortening it until
+	anytimeDeadline milliseconds have passed or it is proven a shortest one.
+	The search starts with anytimeStartWeight on the estimate and takes
+	WEIGHTSTEP off every time it finds a shorter path, reusing every node it
+	has made. If there is no path by the deadline it runs on to the first.
+	A search limit stops it like the deadline, even before a path is found.
+*Parameters:
+*	board --1d array containing the game board
+	path --path to fill with the shortest path found
+*Returns:
+	the number of moves on the path, anytimeLowerBound is left at the fewest
+	moves any path can have
+	-1 if there is no path of MAXPATHLENGTH moves or fewer
+	LIMITREACHED if a search limit was reached before a path was found
+*Author: Andrew Gendreau
+**/
+int anytimeSolve(int board[BOARDSIZE], struct movePath *path);
+
+/**
+*Name: runAnytime
+*Purpose: This function will, given a 1d array that represents the inital board state,
+	solve it with anytimeSolve and print the length of the path, its moves, how far
+	from a shortest path it can be, how many paths were found and the weight of the
+	last, how many nodes were expanded and the most heap held at once, and the
+	search limit that stopped it if one did.
+*Parameters:
+	board --1d Int array to hold the root board
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void runAnytime(int board[BOARDSIZE]);
@@ -75,26 +75,41 @@ FILE *openFile(char *fileName)
 	then using a length 4 array to hold the 4 values we need. It will read a line from the file,
 	grab 4 integers using sscanf, then place those integers into the corresponding values 
 	in the tempory array. It will then run through this array and place them into the 2D array.
+	Blank lines are skipped. A line without 4 integers, or more or fewer than
+	BOARDHEIGHT rows, is an error, so nothing is written past the end of the array.
 *Parameters: 
 	array[BOARDWIDTH][BOARDHEIGHT] --2D form of the user input
 	filePointer --pointer to the file to read from
 *Returns:
-	void
+	0 if the file held a board
+	-1 if it did not
 *Author: Andrew Gendreau
 **/
-void fillTwoDArray(int array[BOARDWIDTH][BOARDHEIGHT], FILE *filePointer)
+int fillTwoDArray(int array[BOARDWIDTH][BOARDHEIGHT], FILE *filePointer)
 {
 	int i;							//current row
 	int j;							//current column/place in currentLineInts
 	char *currentLine = NULL;				//current line read from the file
 	int currentLineInts[BOARDWIDTH];			//temporary array to hold the integers read
 	size_t len = 0;						//size_t variable for getLine
+	int scanned;						//integers sscanf read from the line
 	
 	i = 0;
 
 	while(getline(&currentLine, &len, filePointer) != -1)
 	{
-		sscanf(currentLine, "%d %d %d %d", &currentLineInts[0], &currentLineInts[1], &currentLineInts[2], &currentLineInts[3]);
+		scanned = sscanf(currentLine, "%d %d %d %d", &currentLineInts[0], &currentLineInts[1], &currentLineInts[2], &currentLineInts[3]);
+
+		if(scanned == EOF)				//a blank line
+		{
+			continue;
+		}
+
+		if(scanned != BOARDWIDTH || i == BOARDHEIGHT)
+		{
+			free(currentLine);
+			return -1;
+		}
 		
 		for(j = 0; j < BOARDWIDTH; j++)
 		{
@@ -103,6 +118,48 @@ void fillTwoDArray(int array[BOARDWIDTH][BOARDHEIGHT], FILE *filePointer)
 		i++;
 	}
 
-	i = 0;
-	j = 0;
+	free(currentLine);
+
+	if(i != BOARDHEIGHT)
+	{
+		return -1;
+	}
+
+	return 0;
+}
+
+/**
+*Name: checkBoard
+*Purpose: This function will check that a board read from a file holds every
+	tile from 0 to BOARDSIZE - 1 once. The solvability test and the engines
+	take that as given, a board with a tile twice can pass the test and then
+	never reach the goal.
+*Parameters: 
+	oneDForm[BOARDSIZE] --1D form of the user input
+*Returns:
+	0 if it is a board
+	-1 if it is not
+*Author: Andrew Gendreau
+**/
+int checkBoard(int oneDForm[BOARDSIZE])
+{
+	int seen[BOARDSIZE];					//1 for every tile found so far
+	int i;							//loop control variable
+
+	for(i = 0; i < BOARDSIZE; i++)
+	{
+		seen[i] = 0;
+	}
+
+	for(i = 0; i < BOARDSIZE; i++)
+	{
+		if(oneDForm[i] < 0 || oneDForm[i] >= BOARDSIZE || seen[oneDForm[i]] == 1)
+		{
+			return -1;
+		}
+
+		seen[oneDForm[i]] = 1;
+	}
+
+	return 0;
 }
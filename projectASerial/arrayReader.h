@@ -42,11 +42,27 @@ FILE *openFile(char *fileName);
 	then using a length 4 array to hold the 4 values we need. It will read a line from the file,
 	grab 4 integers using sscanf, then place those integers into the corresponding values 
 	in the tempory array. It will then run through this array and place them into the 2D array.
+	Blank lines are skipped. A line without 4 integers, or more or fewer than
+	BOARDHEIGHT rows, is an error, so nothing is written past the end of the array.
 *Parameters: 
 	array[BOARDWIDTH][BOARDHEIGHT] --2D form of the user input
 	filePointer --pointer to the file to read from
 *Returns:
-	void
+	0 if the file held a board
+	-1 if it did not
+*Author: Andrew Gendreau
+**/
+int fillTwoDArray(int array[BOARDHEIGHT][BOARDWIDTH], FILE *filePointer);
+
+/**
+*Name: checkBoard
+*Purpose: This function will check that a board read from a file holds every
+	tile from 0 to BOARDSIZE - 1 once.
+*Parameters: 
+	oneDForm[BOARDSIZE] --1D form of the user input
+*Returns:
+	0 if it is a board
+	-1 if it is not
 *Author: Andrew Gendreau
 **/
-void fillTwoDArray(int array[BOARDHEIGHT][BOARDWIDTH], FILE *filePointer);
+int checkBoard(int oneDForm[BOARDSIZE]);
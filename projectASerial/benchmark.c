@@ -0,0 +1,1469 @@
+/*NAME: benchmark.c
+DATE: Oct 17th 2026
+VERSION: 1.0
+FILENAME: benchmark.c
+PURPOSE: This module is the invoker for mys15pbench, a set of timing runs
+	for the pieces of mys15p. Each benchmark is picked by name on the
+	command line, for example:
+		./mys15pbench hash 7
+	Where it is needed to compare against the way the solver used to work,
+	the old implementation is kept here as static functions so the solver
+	itself never carries it.
+	Benchmarks:
+		hash [maxPower] --lookup throughput of the visited position table
+			against the old sorted bucket list, for 10^3 up to 10^maxPower
+			positions (default 7). The bucket list walk is O(buckets) per
+			lookup, so it is only run up to 10^LEGACYLISTMAXPOWER positions.
+		board [boards] --nanoseconds per board for encodeBoard and decodeBoard
+			against the old sprintf/strtol computeHashValue (default 10^6 boards).
+		expand [expansions] --nanoseconds per expansion to make the keys of
+			every child of a board, by copying, swapping and encoding each
+			child against applyMoveToKey on the parent key (default 10^6).
+		heuristic [hardBoards] --nodes expanded and seconds taken by iterative
+			deepening A* with each heuristic, over the bundled *movesCase files
+			and hardBoards boards made by random walks from the goal (default 5).
+		concurrent [maxThreads] --inserts per second into the sets of boards
+			seen shared by threads, the compare and swap concurrentSet, the
+			sharded set with a lock per table and one hashList behind one lock,
+			at 1, 2, 4 and so on up to maxThreads threads (default 64). Every
+			key is inserted twice, so half the inserts find it already there.
+		astar [hardBoards] [heuristic] --nodes expanded, nodes stored, most heap
+			held at once and seconds taken by A* and partial expansion A* with
+			the named heuristic (default conflict), over the bundled *movesCase
+			files and hardBoards random walk boards (default 3).
+		constructive [boards] --boards per second solved by the constructive
+			solver, with and without the pass that takes out redundant pairs,
+			over uniformly random solvable boards (default 10^6), with the
+			average and longest path. Every path is then replayed to check it.
+		limits --checks the depth limit of every engine that searches on the
+			bundled *movesCase files. With the limit at the length of a
+			shortest path each has to find one, and with it one less each
+			has to stop at it and say no path is shorter than that length.
+AUTHOR: Andrew Gendreau
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+
+#ifndef HASH_H_
+#define HASH_H_
+#include "hashList.h"
+#endif
+
+#ifndef IDASTAR_H_
+#define IDASTAR_H_
+#include "idaStar.h"
+#endif
+
+#ifndef PARALLELBFS_H_
+#define PARALLELBFS_H_
+#include "parallelBfs.h"
+#endif
+
+#ifndef ASTAR_H_
+#define ASTAR_H_
+#include "aStar.h"
+#endif
+
+#ifndef MEMORY_H_
+#define MEMORY_H_
+#include "memoryTracker.h"
+#endif
+
+#ifndef CONSTRUCTIVE_H_
+#define CONSTRUCTIVE_H_
+#include "constructiveSolver.h"
+#endif
+
+#ifndef FUNCTIONS_H_
+#define FUNCTIONS_H_
+#include "functions-2.h"
+#endif
+
+#ifndef ARRAYREADER_H_
+#define ARRAYREADER_H_
+#include "arrayReader.h"
+#endif
+
+#ifndef SOLVER_H_
+#define SOLVER_H_
+#include "puzzleSolver.h"
+#endif
+
+#ifndef BIDIRECTIONAL_H_
+#define BIDIRECTIONAL_H_
+#include "bidirectional.h"
+#endif
+
+#ifndef PARALLELIDA_H_
+#define PARALLELIDA_H_
+#include "parallelIda.h"
+#endif
+
+#ifndef ANYTIMESEARCH_H_
+#define ANYTIMESEARCH_H_
+#include "anytimeSearch.h"
+#endif
+
+#ifndef SEARCHLIMITS_H_
+#define SEARCHLIMITS_H_
+#include "searchLimits.h"
+#endif
+
+#define BENCHBOARDS 1024						//number of distinct boards cycled through
+#define LEGACYBUCKETSIZE 10						//bucket size of the old bucket list
+#define LEGACYLISTMAXPOWER 4						//largest power of ten the old list is timed at
+#define HARDWALKLENGTH 200						//random moves made from the goal for each hard board
+#define MAXBENCHBOARDS 64						//most boards the heuristic benchmark will run
+#define BOARDNAMESIZE 16						//room for the name of a random walk board
+#define CONCURRENTKEYS 2000000						//distinct keys inserted by the concurrent benchmark
+#define SHAREDCAS 0							//the compare and swap set
+#define SHAREDSHARDED 1							//the sharded set
+#define SHAREDLOCKED 2							//the hashList behind one lock
+#define CONSTRUCTIVEBOARDS 65536					//distinct boards the constructive benchmark cycles through
+#define SHARDCOUNT 64							//tables the sharded set splits the boards over, a power of two
+
+extern unsigned long long idaNodesExpanded;				//nodes expanded by the last idaStarSolve
+extern unsigned long long aStarExpanded;				//nodes expanded by the last aStarSolve
+extern unsigned long long aStarGenerated;				//nodes stored by the last aStarSolve
+extern int aStarPartial;						//1 for aStarSolve to run partial expansion A*
+extern int leanSearch;							//1 for breadthFirstSolve to run a lean search
+
+char *caseFiles[] =							//the bundled cases, shortest first
+{
+	"2movesCase", "6movesCase", "7movesCase", "8movesCase", "9movesCase", "10movesCase",
+	"11movesCase", "12movesCase", "13movesCase", "14movesCase", "15movesCase"
+};
+
+#define CASEFILECOUNT (int) (sizeof(caseFiles) / sizeof(caseFiles[0]))
+
+char *heuristicList[] = {"manhattan", "conflict", "walking", "pdb555", "pdb663", "pdb555r", "pdb663r"};		//heuristics timed, in the order they are printed
+
+#define HEURISTICLISTCOUNT (int) (sizeof(heuristicList) / sizeof(heuristicList[0]))
+
+char *aStarNames[] = {"astar", "pastar"};				//variants the astar benchmark runs, by aStarPartial
+
+/*
+	This is a struct for one of the engines the limits check runs, the name
+	it is printed under and the function that solves a board with it.
+*/
+struct limitedEngine
+{
+	char *name;							//name of the engine
+	int (*solve)(int board[BOARDSIZE], struct movePath *path);	//function that solves a board
+};
+
+/*
+	This is a struct for the set of boards the parallel search used before the
+	concurrentSet, kept here to compare against. The boards are split over
+	SHARDCOUNT hash tables by their key, each with its own lock, so two
+	threads only wait for each other when their boards land in the same one.
+*/
+struct shardedSet
+{
+	struct hashList *shards[SHARDCOUNT];			//the tables
+	pthread_mutex_t locks[SHARDCOUNT];			//lock of each table
+};
+
+char *sharedSetNames[] = {"cas", "sharded", "locked"};			//sets the concurrent benchmark times, by SHARED code
+
+/*
+* This is the work of one thread of the concurrent benchmark, a run of the
+* inserts and the set they go into.
+*/
+struct insertRun
+{
+	pthread_t thread;						//the thread
+	int setType;							//SHAREDCAS, SHAREDSHARDED or SHAREDLOCKED
+	unsigned long long first;					//first insert of the run
+	unsigned long long last;					//one past its last insert
+};
+
+struct concurrentSet *benchCasSet;					//set of the SHAREDCAS runs
+struct shardedSet *benchShardedSet;					//set of the SHAREDSHARDED runs
+struct hashList *benchLockedSet;					//set of the SHAREDLOCKED runs
+pthread_mutex_t benchLock = PTHREAD_MUTEX_INITIALIZER;			//the one lock of the SHAREDLOCKED runs
+
+/*
+* This is the bucket of the old visited position list, a sorted doubly linked
+* list of buckets that each flag BUCKETSIZE consecutive hash values.
+*/
+struct legacyBucket
+{
+	long int bucketArray[LEGACYBUCKETSIZE];				//-1 for a value not seen, 1 for one we have
+	boardKey bucketID;						//ID for this bucket
+	struct legacyBucket *lastBucket;				//pointer to the bucket behind this one.
+	struct legacyBucket *nextBucket;				//pointer to the bucket in front of this one.
+};
+
+struct legacyBucket *legacyHead = NULL;					//first bucket of the old list
+
+/**
+*Name: secondsNow
+*Purpose: This function will read the monotonic clock and return it in seconds.
+*Parameters:
+	void
+*Returns:
+	the current time in seconds
+*Author: Andrew Gendreau
+**/
+static double secondsNow(void)
+{
+	struct timespec now;						//current time
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return now.tv_sec + now.tv_nsec / 1000000000.0;
+}
+
+/**
+*Name: legacyInsert
+*Purpose: This function is the old haveISeenThisPosition. It walks the sorted
+	bucket list until it finds the bucket of the given hash value, creating
+	and linking that bucket in if it does not exist, then checks and sets the
+	flag for the value.
+*Parameters:
+*	hashVal --hash value for a given board position.
+*Returns:
+	1 if given hash already existed
+	-1 if it did not.
+*Author: Andrew Gendreau
+**/
+static int legacyInsert(boardKey hashVal)
+{
+	struct legacyBucket *currentBucket;				//bucket we're working with now
+	struct legacyBucket *lastVisited;				//bucket before currentBucket
+	struct legacyBucket *newBucket;					//bucket created for a new ID
+	boardKey targetBucket;						//bucket of the target value
+	boardKey targetIndex;						//index of the target value
+	int i;								//loop control variable
+
+	targetBucket = hashVal / LEGACYBUCKETSIZE;
+	targetIndex = hashVal % LEGACYBUCKETSIZE;
+
+	lastVisited = NULL;
+	currentBucket = legacyHead;
+
+	while(currentBucket != NULL && currentBucket->bucketID < targetBucket)
+	{
+		lastVisited = currentBucket;
+		currentBucket = currentBucket->nextBucket;
+	}
+
+	if(currentBucket != NULL && currentBucket->bucketID == targetBucket)
+	{
+		if(currentBucket->bucketArray[targetIndex] == 1)
+		{
+			return 1;
+		}
+		currentBucket->bucketArray[targetIndex] = 1;
+		return -1;
+	}
+
+	newBucket = malloc(sizeof(struct legacyBucket));
+
+	for(i = 0; i < LEGACYBUCKETSIZE; i++)
+	{
+		newBucket->bucketArray[i] = -1;
+	}
+
+	newBucket->bucketArray[targetIndex] = 1;
+	newBucket->bucketID = targetBucket;
+	newBucket->lastBucket = lastVisited;
+	newBucket->nextBucket = currentBucket;
+
+	if(currentBucket != NULL)
+	{
+		currentBucket->lastBucket = newBucket;
+	}
+
+	if(lastVisited == NULL)
+	{
+		legacyHead = newBucket;
+	}
+	else
+	{
+		lastVisited->nextBucket = newBucket;
+	}
+	return -1;
+}
+
+/**
+*Name: legacyFree
+*Purpose: This function will free every bucket of the old list.
+*Parameters:
+	void
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+static void legacyFree(void)
+{
+	struct legacyBucket *nextBucket;				//bucket after the one being freed
+
+	while(legacyHead != NULL)
+	{
+		nextBucket = legacyHead->nextBucket;
+		free(legacyHead);
+		legacyHead = nextBucket;
+	}
+}
+
+/**
+*Name: legacyComputeHashValue
+*Purpose: This function is the old computeHashValue. It writes every tile
+	as a hex digit with sprintf and parses the string back with strtol. The
+	string is given room for its terminator here, the old one wrote it one
+	byte past the end of hexBoard.
+*Parameters:
+*	board --array of ints of size BOARDSIZE to represent the board.
+*Returns:
+	hash value of the board as a long int
+*Author: Andrew Gendreau
+**/
+static long int legacyComputeHashValue(int board[BOARDSIZE])
+{
+	int i;								//loop control variable
+	char hexBoard[BOARDSIZE + 1];					//char array to hold the hex form of the current board
+	char *endPtr;							//character pointer for use in strtol
+
+	for(i = 0; i < BOARDSIZE; i++)
+	{
+		char hexChar[2];					//array of length 2 to hold this hex digit
+		sprintf(hexChar, "%x", board[i]);
+		hexBoard[i] = hexChar[0];
+	}
+	hexBoard[i] = '\0';
+
+	return strtol(hexBoard, &endPtr, 16);
+}
+
+/**
+*Name: shuffleBoard
+*Purpose: This function will fill the given board with a random
+	permutation of 0 to 15 using a Fisher-Yates shuffle.
+*Parameters:
+	board --board to fill
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+static void shuffleBoard(int board[BOARDSIZE])
+{
+	int i;								//loop control variable
+	int j;								//index to swap with
+	int temp;							//temporary for the swap
+
+	for(i = 0; i < BOARDSIZE; i++)
+	{
+		board[i] = i;
+	}
+
+	for(i = BOARDSIZE - 1; i > 0; i--)
+	{
+		j = rand() % (i + 1);
+		temp = board[i];
+		board[i] = board[j];
+		board[j] = temp;
+	}
+}
+
+/**
+*Name: randomBoardHash
+*Purpose: This function will, given a seed, make a nonzero key
+	spread over the whole 64 bits like board keys are. It is a splitmix step so the same
+	seed always gives the same value and different seeds never collide.
+*Parameters:
+	seed --counter to turn into a hash value
+*Returns:
+	nonzero key
+*Author: Andrew Gendreau
+**/
+static boardKey randomBoardHash(unsigned long long seed)
+{
+	unsigned long long mixed;					//value being scrambled
+
+	mixed = seed * 0x9e3779b97f4a7c15ULL;
+	mixed = (mixed ^ (mixed >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	mixed = (mixed ^ (mixed >> 27)) * 0x94d049bb133111ebULL;
+	mixed = mixed ^ (mixed >> 31);
+
+	return mixed | 1;
+}
+
+/**
+*Name: timeInserts
+*Purpose: This function will, given a number of positions and which table to
+	use, insert that many distinct hash values, which is the path a new board
+	takes, then look every one of them up again, which is the path a board
+	we have seen before takes. It prints the lookups per second of both.
+*Parameters:
+	states --number of positions to insert
+	useLegacy --1 to time the old bucket list, 0 to time the hash table
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+static void timeInserts(unsigned long long states, int useLegacy)
+{
+	unsigned long long i;						//loop control variable
+	int pass;							//0 for the new positions pass, 1 for the seen pass
+	double start;							//start time of a pass
+	double passTime[2];						//seconds taken by each pass
+	struct hashList *table;						//table under test
+
+	table = NULL;
+
+	if(useLegacy == 0)
+	{
+		table = createHashList(INITIALHASHCAPACITY);
+	}
+
+	for(pass = 0; pass < 2; pass++)
+	{
+		start = secondsNow();
+
+		for(i = 0; i < states; i++)
+		{
+			if(useLegacy == 1)
+			{
+				legacyInsert(randomBoardHash(i));
+			}
+			else
+			{
+				insertPosition(table, randomBoardHash(i));
+			}
+		}
+		passTime[pass] = secondsNow() - start;
+	}
+
+	if(useLegacy == 1)
+	{
+		legacyFree();
+	}
+	else
+	{
+		destroyHashList(table);
+	}
+
+	printf("%-12llu %-12s %16.0f %16.0f\n", states, useLegacy == 1 ? "bucketlist" : "open",
+		states / passTime[0], states / passTime[1]);
+}
+
+/**
+*Name: benchHash
+*Purpose: This function will, for every power of ten from 10^3 up to 10^maxPower,
+	time the visited position table with that many positions. The old
+	bucket list is timed the same way while the size is at most
+	10^LEGACYLISTMAXPOWER, which is why the sizes start at 10^3.
+*Parameters:
+	maxPower --largest power of ten to run
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+static void benchHash(int maxPower)
+{
+	unsigned long long states;					//number of positions for this run
+	int power;							//current power of ten
+
+	printf("%-12s %-12s %16s %16s\n", "states", "table", "new lookups/s", "seen lookups/s");
+
+	states = 100;
+
+	for(power = 3; power <= maxPower; power++)
+	{
+		states = states * 10;
+
+		timeInserts(states, 0);
+
+		if(power <= LEGACYLISTMAXPOWER)
+		{
+			timeInserts(states, 1);
+		}
+	}
+}
+
+/**
+*Name: benchBoard
+*Purpose: This function will time the old string based hash against
+	encodeBoard and decodeBoard over a fixed set of shuffled boards and print
+	the nanoseconds each takes per board. The results are summed into a
+	checksum that is printed so none of the calls can be optimized away.
+*Parameters:
+	boards --number of boards to hash with each function
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+static void benchBoard(long boards)
+{
+	static int boardSet[BENCHBOARDS][BOARDSIZE];			//boards cycled through
+	static boardKey keySet[BENCHBOARDS];				//keys of the boards in boardSet
+	int decoded[BOARDSIZE];						//board unpacked from a key
+	long i;								//loop control variable
+	double start;							//start time of a run
+	double legacyTime;						//seconds for computeHashValue
+	double encodeTime;						//seconds for encodeBoard
+	double decodeTime;						//seconds for decodeBoard
+	unsigned long long checksum;					//sum of every result
+
+	srand(15);
+
+	for(i = 0; i < BENCHBOARDS; i++)
+	{
+		shuffleBoard(boardSet[i]);
+		keySet[i] = encodeBoard(boardSet[i]);
+	}
+
+	checksum = 0;
+
+	start = secondsNow();
+	for(i = 0; i < boards; i++)
+	{
+		checksum += (unsigned long long) legacyComputeHashValue(boardSet[i % BENCHBOARDS]);
+	}
+	legacyTime = secondsNow() - start;
+
+	start = secondsNow();
+	for(i = 0; i < boards; i++)
+	{
+		checksum += encodeBoard(boardSet[i % BENCHBOARDS]);
+	}
+	encodeTime = secondsNow() - start;
+
+	start = secondsNow();
+	for(i = 0; i < boards; i++)
+	{
+		decodeBoard(keySet[i % BENCHBOARDS], decoded);
+		checksum += (unsigned long long) decoded[i % BOARDSIZE];
+	}
+	decodeTime = secondsNow() - start;
+
+	printf("%-22s %10.2f ns/board\n", "computeHashValue (old)", legacyTime * 1e9 / boards);
+	printf("%-22s %10.2f ns/board\n", "encodeBoard", encodeTime * 1e9 / boards);
+	printf("%-22s %10.2f ns/board\n", "decodeBoard", decodeTime * 1e9 / boards);
+	printf("checksum %llx\n", checksum);
+}
+
+/**
+*Name: benchExpand
+*Purpose: This function will time making the keys of every child of a board
+	the way processNode used to, by copying the board, swapping the tile
+	with the blank and encoding the copy, against applyMoveToKey on the
+	parent's key. The tiles that can move come from the move tables in both. It prints the nanoseconds per expansion
+	of both and checks both ways give the same keys.
+*Parameters:
+	expansions --number of boards to expand with each method
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+static void benchExpand(long expansions)
+{
+	static int boardSet[BENCHBOARDS][BOARDSIZE];			//boards cycled through
+	static boardKey keySet[BENCHBOARDS];				//keys of the boards in boardSet
+	static int blankSet[BENCHBOARDS];				//blank index of each board
+	int childBoard[BOARDSIZE];					//board of the child being made
+	const int *moveSet;						//1d indexes of the tiles that can move in
+	long i;								//loop control variable
+	int b;								//board being expanded
+	int m;								//move being made
+	double start;							//start time of a run
+	double copyTime;						//seconds for copy, swap and encode
+	double keyTime;							//seconds for applyMoveToKey
+	boardKey copySum;						//sum of the keys made by copying
+	boardKey keySum;						//sum of the keys made from the parent key
+
+	srand(15);
+
+	for(b = 0; b < BENCHBOARDS; b++)
+	{
+		shuffleBoard(boardSet[b]);
+		keySet[b] = encodeBoard(boardSet[b]);
+		blankSet[b] = findBlankIndex(boardSet[b]);
+	}
+
+	copySum = 0;
+	start = secondsNow();
+	for(i = 0; i < expansions; i++)
+	{
+		b = (int) (i % BENCHBOARDS);
+
+		moveSet = tilesForBlank[blankSet[b]];
+
+		for(m = 0; m < movesForBlank[blankSet[b]]; m++)
+		{
+			memcpy(childBoard, boardSet[b], sizeof(childBoard));
+			swap(blankSet[b], moveSet[m], childBoard);
+			copySum += encodeBoard(childBoard);
+		}
+	}
+	copyTime = secondsNow() - start;
+
+	keySum = 0;
+	start = secondsNow();
+	for(i = 0; i < expansions; i++)
+	{
+		b = (int) (i % BENCHBOARDS);
+
+		moveSet = tilesForBlank[blankSet[b]];
+
+		for(m = 0; m < movesForBlank[blankSet[b]]; m++)
+		{
+			keySum += applyMoveToKey(keySet[b], blankSet[b], moveSet[m]);
+		}
+	}
+	keyTime = secondsNow() - start;
+
+	printf("%-22s %10.2f ns/expansion\n", "copy, swap, encode", copyTime * 1e9 / expansions);
+	printf("%-22s %10.2f ns/expansion\n", "applyMoveToKey", keyTime * 1e9 / expansions);
+	printf("keys %s\n", copySum == keySum ? "match" : "DIFFER");
+}
+
+/**
+*Name: walkFromGoal
+*Purpose: This function will fill the given board with the board reached by
+	HARDWALKLENGTH random moves from the goal, never undoing the move before.
+	Every board reached this way is solvable.
+*Parameters:
+	board --board to fill
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+static void walkFromGoal(int board[BOARDSIZE])
+{
+	int blankIndex;							//index of the blank
+	int lastDirection;						//direction of the move before
+	int choice;							//move picked from the move tables
+	int i;								//loop control variable
+
+	for(i = 0; i < BOARDSIZE - 1; i++)
+	{
+		board[i] = i + 1;
+	}
+	board[BOARDSIZE - 1] = 0;
+
+	blankIndex = BOARDSIZE - 1;
+	lastDirection = NOMOVE;
+
+	for(i = 0; i < HARDWALKLENGTH; i++)
+	{
+		do
+		{
+			choice = rand() % movesForBlank[blankIndex];
+		}
+		while(lastDirection != NOMOVE && directionsForBlank[blankIndex][choice] == (lastDirection ^ 1));
+
+		lastDirection = directionsForBlank[blankIndex][choice];
+		swap(blankIndex, tilesForBlank[blankIndex][choice], board);
+		blankIndex = tilesForBlank[blankIndex][choice];
+	}
+}
+
+/**
+*Name: loadBenchBoards
+*Purpose: This function will fill boardSet with every bundled case file it can
+	open, then hardBoards boards made by random walks from the goal, and point
+	boardNames at the name each is printed under. The walks are seeded the
+	same every time, so every benchmark gets the same boards.
+*Parameters:
+	boardSet --boards to fill, room for CASEFILECOUNT + MAXBENCHBOARDS
+	boardNames --names to fill, the same size
+	hardBoards --number of random walk boards to add, at most MAXBENCHBOARDS
+*Returns:
+	the number of boards filled
+*Author: Andrew Gendreau
+**/
+static int loadBenchBoards(int boardSet[][BOARDSIZE], char *boardNames[], int hardBoards)
+{
+	static char hardNames[MAXBENCHBOARDS][BOARDNAMESIZE];		//names of the random walk boards
+	int twoDBoard[BOARDHEIGHT][BOARDWIDTH];				//case file as it is read
+	FILE *filePointer;						//case file being read
+	int readResult;							//what reading it returned
+	int boardCount;							//number of boards filled
+	int b;								//board being filled
+
+	if(hardBoards > MAXBENCHBOARDS)
+	{
+		hardBoards = MAXBENCHBOARDS;
+	}
+
+	boardCount = 0;
+
+	for(b = 0; b < CASEFILECOUNT; b++)
+	{
+		filePointer = openFile(caseFiles[b]);
+
+		if(filePointer == NULL)
+		{
+			printf("Skipping %s, it could not be opened\n", caseFiles[b]);
+			continue;
+		}
+
+		readResult = fillTwoDArray(twoDBoard, filePointer);
+		fclose(filePointer);
+		mapTwoDArrayToOneD(twoDBoard, boardSet[boardCount]);
+
+		if(readResult < 0 || checkBoard(boardSet[boardCount]) < 0)
+		{
+			printf("Skipping %s, it does not hold a board\n", caseFiles[b]);
+			continue;
+		}
+
+		boardNames[boardCount] = caseFiles[b];
+		boardCount++;
+	}
+
+	srand(15);
+
+	for(b = 0; b < hardBoards; b++)
+	{
+		walkFromGoal(boardSet[boardCount]);
+		sprintf(hardNames[b], "walk %d", b);
+		boardNames[boardCount] = hardNames[b];
+		boardCount++;
+	}
+
+	return boardCount;
+}
+
+/**
+*Name: benchHeuristic
+*Purpose: This function will solve every bundled case file it can open and
+	hardBoards random walk boards with iterative deepening A* once with each
+	heuristic, and print the moves, nodes expanded and seconds of every solve,
+	then the totals for each heuristic. The tables of every heuristic are built
+	before the timing starts.
+*Parameters:
+	hardBoards --number of random walk boards to add to the cases
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+static void benchHeuristic(int hardBoards)
+{
+	static int boardSet[CASEFILECOUNT + MAXBENCHBOARDS][BOARDSIZE];	//boards to solve
+	static char *boardNames[CASEFILECOUNT + MAXBENCHBOARDS];	//name each board is printed under
+	struct movePath path;						//path found, only its length is printed
+	struct heuristic *heuristic;					//heuristic being timed
+	unsigned long long totalNodes[HEURISTICLISTCOUNT];		//nodes over every board, by heuristic
+	double totalTime[HEURISTICLISTCOUNT];				//seconds over every board, by heuristic
+	double start;							//start time of a solve
+	double solveTime;						//seconds for one solve
+	int boardCount;							//number of boards in boardSet
+	int moves;							//length of the path found
+	int b;								//board being solved
+	int h;								//heuristic being timed
+
+	boardCount = loadBenchBoards(boardSet, boardNames, hardBoards);
+
+	for(h = 0; h < HEURISTICLISTCOUNT; h++)
+	{
+		findHeuristic(heuristicList[h]);
+		totalNodes[h] = 0;
+		totalTime[h] = 0;
+	}
+
+	printf("%-12s %-10s %6s %14s %10s\n", "board", "heuristic", "moves", "nodes", "seconds");
+
+	for(b = 0; b < boardCount; b++)
+	{
+		for(h = 0; h < HEURISTICLISTCOUNT; h++)
+		{
+			heuristic = findHeuristic(heuristicList[h]);
+			setIdaHeuristic(heuristic);
+
+			start = secondsNow();
+			moves = idaStarSolve(boardSet[b], &path);
+			solveTime = secondsNow() - start;
+
+			totalNodes[h] += idaNodesExpanded;
+			totalTime[h] += solveTime;
+
+			printf("%-12s %-10s %6d %14llu %10.3f\n", boardNames[b], heuristicList[h], moves,
+				idaNodesExpanded, solveTime);
+		}
+	}
+
+	for(h = 0; h < HEURISTICLISTCOUNT; h++)
+	{
+		printf("%-12s %-10s %6s %14llu %10.3f\n", "total", heuristicList[h], "", totalNodes[h], totalTime[h]);
+	}
+}
+
+/**
+*Name: benchAStar
+*Purpose: This function will solve every bundled case file it can open and
+	hardBoards random walk boards with A* and with partial expansion A*, both
+	with the named heuristic, and print the moves, nodes expanded, nodes
+	stored, most heap held at once and seconds of every solve, then the totals
+	for each. The peak is put back to the heap in use before every solve, so
+	it is the most that solve held.
+*Parameters:
+	hardBoards --number of random walk boards to add to the cases
+	heuristicName --name of the heuristic to solve with
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+static void benchAStar(int hardBoards, char *heuristicName)
+{
+	static int boardSet[CASEFILECOUNT + MAXBENCHBOARDS][BOARDSIZE];	//boards to solve
+	static char *boardNames[CASEFILECOUNT + MAXBENCHBOARDS];	//name each board is printed under
+	struct movePath path;						//path found, only its length is printed
+	struct heuristic *heuristic;					//heuristic both variants use
+	unsigned long long totalExpanded[2];				//nodes expanded over every board, by variant
+	unsigned long long totalStored[2];				//nodes stored over every board, by variant
+	size_t largestPeak[2];						//most heap held by any solve, by variant
+	double totalTime[2];						//seconds over every board, by variant
+	double start;							//start time of a solve
+	double solveTime;						//seconds for one solve
+	size_t peak;							//most heap held by one solve
+	int boardCount;							//number of boards in boardSet
+	int moves;							//length of the path found
+	int b;								//board being solved
+	int v;								//variant being run, as aStarPartial
+
+	heuristic = findHeuristic(heuristicName);
+
+	if(heuristic == NULL)
+	{
+		printf("%s is not a heuristic, pick one of %s\n", heuristicName, heuristicNames());
+		return;
+	}
+
+	setIdaHeuristic(heuristic);
+	boardCount = loadBenchBoards(boardSet, boardNames, hardBoards);
+
+	for(v = 0; v < 2; v++)
+	{
+		totalExpanded[v] = 0;
+		totalStored[v] = 0;
+		largestPeak[v] = 0;
+		totalTime[v] = 0;
+	}
+
+	printf("%-12s %-8s %6s %12s %12s %14s %10s\n", "board", "engine", "moves", "expanded", "stored",
+		"peak bytes", "seconds");
+
+	for(b = 0; b < boardCount; b++)
+	{
+		for(v = 0; v < 2; v++)
+		{
+			aStarPartial = v;
+			memoryUsage.peakBytes = memoryUsage.currentBytes;
+
+			start = secondsNow();
+			moves = aStarSolve(boardSet[b], &path);
+			solveTime = secondsNow() - start;
+
+			peak = memoryUsage.peakBytes - memoryUsage.currentBytes;
+			totalExpanded[v] += aStarExpanded;
+			totalStored[v] += aStarGenerated;
+			totalTime[v] += solveTime;
+
+			if(peak > largestPeak[v])
+			{
+				largestPeak[v] = peak;
+			}
+
+			printf("%-12s %-8s %6d %12llu %12llu %14lu %10.3f\n", boardNames[b], aStarNames[v], moves,
+				aStarExpanded, aStarGenerated, (unsigned long) peak, solveTime);
+		}
+	}
+
+	for(v = 0; v < 2; v++)
+	{
+		printf("%-12s %-8s %6s %12llu %12llu %14lu %10.3f\n", "total", aStarNames[v], "", totalExpanded[v],
+			totalStored[v], (unsigned long) largestPeak[v], totalTime[v]);
+	}
+}
+
+/**
+*Name: randomSolvableBoard
+*Purpose: This function will fill the given board with a random board that
+	can be solved. A random permutation that can not be is made into one that
+	can by swapping two tiles, so every solvable board is as likely.
+*Parameters:
+	board --board to fill
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+static void randomSolvableBoard(int board[BOARDSIZE])
+{
+	int first;							//index of the first of the tiles swapped
+	int temp;							//temporary for the swap
+
+	shuffleBoard(board);
+
+	if(solvable(BOARDHEIGHT - findBlankIndex(board) / BOARDWIDTH, board) == 0)
+	{
+		first = (board[0] == 0 || board[1] == 0) ? 2 : 0;
+		temp = board[first];
+		board[first] = board[first + 1];
+		board[first + 1] = temp;
+	}
+}
+
+/**
+*Name: replayPath
+*Purpose: This function will, given a board and a constructive path, make the
+	moves on a copy of the board, checking each moves the tile it names in
+	the direction it names, and check the copy ends at the winning state.
+*Parameters:
+	board --board the path starts from
+	path --path to replay
+*Returns:
+	1 if the path is legal and solves the board
+	0 if it is not
+*Author: Andrew Gendreau
+**/
+static int replayPath(int board[BOARDSIZE], struct constructivePath *path)
+{
+	int currentBoard[BOARDSIZE];					//board the moves are made on
+	int blankIndex;							//index of the blank
+	int tileIndex;							//index of the tile moved
+	int m;								//move being made
+	int i;								//loop control variable
+
+	memcpy(currentBoard, board, sizeof(currentBoard));
+	blankIndex = findBlankIndex(currentBoard);
+
+	for(m = 0; m < path->length; m++)
+	{
+		tileIndex = NOMOVE;
+
+		for(i = 0; i < movesForBlank[blankIndex]; i++)
+		{
+			if(currentBoard[tilesForBlank[blankIndex][i]] == CODETILE(path->moves[m])
+				&& directionsForBlank[blankIndex][i] == CODEDIRECTION(path->moves[m]))
+			{
+				tileIndex = tilesForBlank[blankIndex][i];
+			}
+		}
+
+		if(tileIndex == NOMOVE)
+		{
+			return 0;
+		}
+
+		swap(blankIndex, tileIndex, currentBoard);
+		blankIndex = tileIndex;
+	}
+
+	return encodeBoard(currentBoard) == WINNINGHASH;
+}
+
+/**
+*Name: benchConstructive
+*Purpose: This function will solve boards boards with the constructive solver,
+	cycling through CONSTRUCTIVEBOARDS random solvable boards, once as it is and
+	once with the redundant pairs taken out, and print the boards per second,
+	microseconds per board and average and longest path of each. Every distinct
+	board is then solved again both ways and replayed, and the number that did
+	not solve their board printed.
+*Parameters:
+	boards --number of boards to solve each way
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+static void benchConstructive(long boards)
+{
+	static int boardSet[CONSTRUCTIVEBOARDS][BOARDSIZE];		//boards to solve
+	struct constructivePath path;					//path found
+	unsigned long long totalMoves;					//moves over every board
+	double start;							//start time of the run
+	double seconds;							//seconds it took
+	long failures;							//paths that did not solve their board
+	long n;								//board being solved
+	int longest;							//longest path
+	int prune;							//1 for the run that takes out redundant pairs
+
+	srand(15);
+
+	for(n = 0; n < CONSTRUCTIVEBOARDS; n++)
+	{
+		randomSolvableBoard(boardSet[n]);
+	}
+
+	printf("%-8s %14s %14s %12s %10s\n", "pairs", "boards/second", "microseconds", "average", "longest");
+
+	for(prune = 0; prune < 2; prune++)
+	{
+		totalMoves = 0;
+		longest = 0;
+		start = secondsNow();
+
+		for(n = 0; n < boards; n++)
+		{
+			constructiveSolve(boardSet[n % CONSTRUCTIVEBOARDS], &path);
+
+			if(prune == 1)
+			{
+				removeRedundantPairs(&path);
+			}
+
+			totalMoves += path.length;
+
+			if(path.length > longest)
+			{
+				longest = path.length;
+			}
+		}
+
+		seconds = secondsNow() - start;
+
+		printf("%-8s %14.0f %14.3f %12.2f %10d\n", prune == 1 ? "removed" : "kept", boards / seconds,
+			seconds * 1000000.0 / boards, (double) totalMoves / boards, longest);
+	}
+
+	failures = 0;
+
+	for(n = 0; n < CONSTRUCTIVEBOARDS; n++)
+	{
+		for(prune = 0; prune < 2; prune++)
+		{
+			if(constructiveSolve(boardSet[n], &path) < 0)
+			{
+				failures++;
+				continue;
+			}
+
+			if(prune == 1)
+			{
+				removeRedundantPairs(&path);
+			}
+
+			if(replayPath(boardSet[n], &path) == 0)
+			{
+				failures++;
+			}
+		}
+	}
+
+	printf("Replayed %d boards both ways, %ld paths did not solve their board\n", CONSTRUCTIVEBOARDS, failures);
+}
+
+/**
+*Name: solveBreadthFirst
+*Purpose: This function will solve a board with breadthFirstSolve and free
+	what it kept, for the limits check.
+*Parameters:
+	board --board to solve
+	path --path to fill
+*Returns:
+	what breadthFirstSolve returned
+*Author: Andrew Gendreau
+**/
+static int solveBreadthFirst(int board[BOARDSIZE], struct movePath *path)
+{
+	int length;							//what the solve returned
+
+	length = breadthFirstSolve(board, path);
+	releaseBreadthFirst();
+
+	return length;
+}
+
+/**
+*Name: solveLeanBreadthFirst
+*Purpose: This function will solve a board with a lean breadthFirstSolve and
+	free what it kept, for the limits check.
+*Parameters:
+	board --board to solve
+	path --path to fill
+*Returns:
+	what breadthFirstSolve returned
+*Author: Andrew Gendreau
+**/
+static int solveLeanBreadthFirst(int board[BOARDSIZE], struct movePath *path)
+{
+	int length;							//what the solve returned
+
+	leanSearch = 1;
+	length = solveBreadthFirst(board, path);
+	leanSearch = 0;
+
+	return length;
+}
+
+/**
+*Name: solvePartialAStar
+*Purpose: This function will solve a board with partial expansion A*, for the
+	limits check.
+*Parameters:
+	board --board to solve
+	path --path to fill
+*Returns:
+	what aStarSolve returned
+*Author: Andrew Gendreau
+**/
+static int solvePartialAStar(int board[BOARDSIZE], struct movePath *path)
+{
+	int length;							//what the solve returned
+
+	aStarPartial = 1;
+	length = aStarSolve(board, path);
+	aStarPartial = 0;
+
+	return length;
+}
+
+struct limitedEngine limitedEngines[] =					//engines the limits check runs
+{
+	{"bfs", solveBreadthFirst},
+	{"bfs -l", solveLeanBreadthFirst},
+	{"ida", idaStarSolve},
+	{"bidir", bidirectionalSolve},
+	{"parallel", parallelBfsSolve},
+	{"pida", parallelIdaSolve},
+	{"astar", aStarSolve},
+	{"pastar", solvePartialAStar},
+	{"anytime", anytimeSolve}
+};
+
+#define LIMITEDENGINECOUNT (int) (sizeof(limitedEngines) / sizeof(limitedEngines[0]))
+
+/**
+*Name: benchLimits
+*Purpose: This function will check the depth limit of every engine that
+	searches, on every bundled case. The length of a shortest path is found
+	first with iterative deepening A* and no limit. With the depth limit at
+	that length each engine has to find a path that long, and with it one
+	less each has to stop at the depth limit with that length as the fewest
+	moves a path can have. It prints every run that does not and how many.
+*Parameters:
+	void
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+static void benchLimits(void)
+{
+	static int boardSet[CASEFILECOUNT][BOARDSIZE];			//boards to solve
+	static char *boardNames[CASEFILECOUNT];				//name each board is printed under
+	struct movePath path;						//path found
+	int boardCount;							//number of boards loaded
+	int shortest;							//length of a shortest path
+	int length;							//what a solve returned
+	int failures;							//runs that did not keep the limit
+	int b;								//board being solved
+	int e;								//engine solving it
+
+	boardCount = loadBenchBoards(boardSet, boardNames, 0);
+	failures = 0;
+
+	for(b = 0; b < boardCount; b++)
+	{
+		searchLimits.maxDepth = 0;
+		startSearchLimits();
+		shortest = idaStarSolve(boardSet[b], &path);
+
+		for(e = 0; e < LIMITEDENGINECOUNT; e++)
+		{
+			searchLimits.maxDepth = shortest;
+			startSearchLimits();
+			length = limitedEngines[e].solve(boardSet[b], &path);
+
+			if(length != shortest)
+			{
+				printf("%-12s %-9s found %d moves with the limit at %d\n", boardNames[b],
+					limitedEngines[e].name, length, shortest);
+				failures++;
+			}
+
+			searchLimits.maxDepth = shortest - 1;
+			startSearchLimits();
+			length = limitedEngines[e].solve(boardSet[b], &path);
+
+			if(length != LIMITREACHED || atomic_load(&limitHit) != LIMITDEPTH || limitLowerBound != shortest)
+			{
+				printf("%-12s %-9s returned %d, no path shorter than %d, with the limit at %d\n", boardNames[b],
+					limitedEngines[e].name, length, limitLowerBound, shortest - 1);
+				failures++;
+			}
+		}
+	}
+
+	searchLimits.maxDepth = 0;
+
+	printf("Checked %d engines on %d boards, %d runs did not keep the depth limit\n", LIMITEDENGINECOUNT,
+		boardCount, failures);
+}
+
+/**
+*Name: shardOf
+*Purpose: This function will, given a hash value, pick the table of a sharded
+	set it belongs in. The tables pick a slot from the low bits of a scrambled
+	key, so the shard is taken from the high bits of a different scramble.
+*Parameters:
+*	hashVal --hash value
+*Returns:
+	index of the table
+*Author: Andrew Gendreau
+**/
+static int shardOf(boardKey hashVal)
+{
+	return (int) ((hashVal * 0x9e3779b97f4a7c15ULL) >> 58) & (SHARDCOUNT - 1);
+}
+
+/**
+*Name: createShardedSet
+*Purpose: This function will create an empty sharded set.
+*Parameters:
+*	void
+*Returns:
+	pointer to the set
+*Author: Andrew Gendreau
+**/
+static struct shardedSet *createShardedSet(void)
+{
+	struct shardedSet *set;							//set to be returned
+	int i;									//loop control variable
+
+	set = trackedMalloc(sizeof(struct shardedSet));
+
+	for(i = 0; i < SHARDCOUNT; i++)
+	{
+		set->shards[i] = createHashList(INITIALHASHCAPACITY);
+		pthread_mutex_init(&set->locks[i], NULL);
+	}
+
+	return set;
+}
+
+/**
+*Name: insertShared
+*Purpose: This function will, given a sharded set and a hash value, lock the
+	table the value belongs in and insert it, from any thread.
+*Parameters:
+*	set --set to insert into
+	hashVal --hash value to insert
+*Returns:
+	1 if it was already there
+	-1 if it was inserted
+*Author: Andrew Gendreau
+**/
+static int insertShared(struct shardedSet *set, boardKey hashVal)
+{
+	int shard;								//table the value belongs in
+	int result;								//what inserting it returned
+
+	shard = shardOf(hashVal);
+
+	pthread_mutex_lock(&set->locks[shard]);
+	result = insertPosition(set->shards[shard], hashVal);
+	pthread_mutex_unlock(&set->locks[shard]);
+
+	return result;
+}
+
+/**
+*Name: destroyShardedSet
+*Purpose: This function will free every table of a sharded set and the set.
+*Parameters:
+*	set --set to free
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+static void destroyShardedSet(struct shardedSet *set)
+{
+	int i;									//loop control variable
+
+	for(i = 0; i < SHARDCOUNT; i++)
+	{
+		destroyHashList(set->shards[i]);
+		pthread_mutex_destroy(&set->locks[i]);
+	}
+
+	trackedFree(set, sizeof(struct shardedSet));
+}
+
+/**
+*Name: insertWorker
+*Purpose: This function is run by each thread of the concurrent benchmark. It
+	will make the keys of its run of inserts, insert n going in as key n modulo
+	CONCURRENTKEYS, and insert them into its run's set.
+*Parameters:
+	argument --the thread's insertRun
+*Returns:
+	NULL
+*Author: Andrew Gendreau
+**/
+static void *insertWorker(void *argument)
+{
+	struct insertRun *run;						//this thread's run
+	boardKey key;							//key being inserted
+	unsigned long long i;						//loop control variable
+
+	run = argument;
+
+	for(i = run->first; i < run->last; i++)
+	{
+		key = randomBoardHash(i % CONCURRENTKEYS);
+
+		if(run->setType == SHAREDCAS)
+		{
+			insertConcurrent(benchCasSet, key);
+		}
+		else if(run->setType == SHAREDSHARDED)
+		{
+			insertShared(benchShardedSet, key);
+		}
+		else
+		{
+			pthread_mutex_lock(&benchLock);
+			insertPosition(benchLockedSet, key);
+			pthread_mutex_unlock(&benchLock);
+		}
+	}
+
+	return NULL;
+}
+
+/**
+*Name: benchConcurrent
+*Purpose: This function will, for 1, 2, 4 and so on up to maxThreads threads,
+	split 2 * CONCURRENTKEYS inserts evenly over the threads and time them into
+	each of the shared sets, then print the inserts per second. The compare and
+	swap set is made with room for every key, as the search reserves before
+	each level, and the others grow as they are filled.
+*Parameters:
+	maxThreads --most threads to run
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+static void benchConcurrent(int maxThreads)
+{
+	static struct insertRun runs[MAXTHREADS];			//the threads of one timing
+	unsigned long long inserts;					//inserts over every thread
+	double start;							//start time of a timing
+	double seconds[3];						//seconds taken by each set
+	int threads;							//threads of this timing
+	int setType;							//set being timed
+	int t;								//loop control variable
+
+	if(maxThreads > MAXTHREADS)
+	{
+		maxThreads = MAXTHREADS;
+	}
+
+	inserts = 2ULL * CONCURRENTKEYS;
+
+	printf("%-8s %18s %18s %18s\n", "threads", "cas inserts/s", "sharded inserts/s", "locked inserts/s");
+
+	for(threads = 1; threads <= maxThreads; threads = threads * 2)
+	{
+		for(setType = SHAREDCAS; setType <= SHAREDLOCKED; setType++)
+		{
+			benchCasSet = createConcurrentSet(CONCURRENTKEYS);
+			benchShardedSet = createShardedSet();
+			benchLockedSet = createHashList(INITIALHASHCAPACITY);
+
+			start = secondsNow();
+
+			for(t = 0; t < threads; t++)
+			{
+				runs[t].setType = setType;
+				runs[t].first = inserts * t / threads;
+				runs[t].last = inserts * (t + 1) / threads;
+				pthread_create(&runs[t].thread, NULL, insertWorker, &runs[t]);
+			}
+
+			for(t = 0; t < threads; t++)
+			{
+				pthread_join(runs[t].thread, NULL);
+			}
+
+			seconds[setType] = secondsNow() - start;
+
+			if(setType == SHAREDCAS && atomic_load(&benchCasSet->count) != CONCURRENTKEYS)
+			{
+				printf("The %s set holds %lu keys, not %d\n", sharedSetNames[setType],
+					(unsigned long) atomic_load(&benchCasSet->count), CONCURRENTKEYS);
+			}
+
+			destroyConcurrentSet(benchCasSet);
+			destroyShardedSet(benchShardedSet);
+			destroyHashList(benchLockedSet);
+		}
+
+		printf("%-8d %18.0f %18.0f %18.0f\n", threads, inserts / seconds[SHAREDCAS],
+			inserts / seconds[SHAREDSHARDED], inserts / seconds[SHAREDLOCKED]);
+	}
+}
+
+/**
+*Name: main
+*Purpose: This function will run the benchmark named by the first command
+	line arguement, passing it the rest of the arguements.
+*Parameters:
+	int argc --Main parameter, this is a count of command line arguements
+	char *argv[] --Main parameter, this is a pointer to an array of pointers.
+*Returns:
+	0 if a benchmark ran, 1 if the name was not known
+*Author: Andrew Gendreau
+**/
+int main(int argc, char *argv[])
+{
+	if(argc >= 2 && strcmp(argv[1], "hash") == 0)
+	{
+		benchHash(argc >= 3 ? atoi(argv[2]) : 7);
+		return 0;
+	}
+
+	if(argc >= 2 && strcmp(argv[1], "board") == 0)
+	{
+		benchBoard(argc >= 3 ? atol(argv[2]) : 1000000);
+		return 0;
+	}
+
+	if(argc >= 2 && strcmp(argv[1], "expand") == 0)
+	{
+		benchExpand(argc >= 3 ? atol(argv[2]) : 1000000);
+		return 0;
+	}
+
+	if(argc >= 2 && strcmp(argv[1], "heuristic") == 0)
+	{
+		benchHeuristic(argc >= 3 ? atoi(argv[2]) : 5);
+		return 0;
+	}
+
+	if(argc >= 2 && strcmp(argv[1], "concurrent") == 0)
+	{
+		benchConcurrent(argc >= 3 ? atoi(argv[2]) : MAXTHREADS);
+		return 0;
+	}
+
+	if(argc >= 2 && strcmp(argv[1], "astar") == 0)
+	{
+		benchAStar(argc >= 3 ? atoi(argv[2]) : 3, argc >= 4 ? argv[3] : "conflict");
+		return 0;
+	}
+
+	if(argc >= 2 && strcmp(argv[1], "constructive") == 0)
+	{
+		benchConstructive(argc >= 3 ? atol(argv[2]) : 1000000);
+		return 0;
+	}
+
+	if(argc >= 2 && strcmp(argv[1], "limits") == 0)
+	{
+		benchLimits();
+		return 0;
+	}
+
+	printf("Usage: %s hash [maxPower] | board [boards] | expand [expansions] | heuristic [hardBoards]"
+		" | concurrent [maxThreads] | astar [hardBoards] [heuristic] | constructive [boards] | limits\n", argv[0]);
+	return 1;
+}
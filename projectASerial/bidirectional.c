@@ -0,0 +1,398 @@
+/*NAME: bidirectional.c
+DATE: Oct 17th 2026
+VERSION: 1.0
+FILENAME: bidirectional.c
+PURPOSE: This module will be the bidirectional breadth first search engine. The
+	forward search makes about b^d boards to find a path of d moves, where b is
+	a little over 2. Growing one search from the board we were given and another
+	from the winning board, until they make the same board, only takes each of
+	them halfway, so together they make about 2b^(d/2) boards.
+	Each side is run a level at a time like the forward search, and the side
+	whose current level is smaller is the one grown, so neither gets far ahead.
+	Every new board is looked up in the other side's map. Once one is found
+	the path is the moves from our root to it followed by the moves from it back
+	to the other root, and because every level of both sides was finished before
+	this one was started, no shorter path can have been missed.
+	The backward side is grown from the winning board with the same moves, every
+	move can be undone, so a move from the other side's parent to its child is
+	the child's move to the parent in the other direction.
+AUTHOR: Andrew Gendreau
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef BIDIRECTIONAL_H_
+#define BIDIRECTIONAL_H_
+#include "bidirectional.h"
+#endif
+
+#ifndef MEMORY_H_
+#define MEMORY_H_
+#include "memoryTracker.h"
+#endif
+
+#ifndef SEARCHLIMITS_H_
+#define SEARCHLIMITS_H_
+#include "searchLimits.h"
+#endif
+
+unsigned long long sideNodesExpanded[2];					//nodes expanded on each side
+
+/**
+*Name: addSideNode
+*Purpose: This function will, given a side and a board, add a node for the
+	board to the side if the side has not made that board yet.
+*Parameters:
+*	side --side to add to
+	key --key of the board
+	parent --index of the parent node, ROOTPARENT for a root
+	direction --direction code of the move from the parent, NOMOVE for a root
+	blankIndex --1d index of the blank on the board
+*Returns:
+	index of the new node
+	NOPOSITIONVALUE if the side had already made the board
+*Author: Andrew Gendreau
+**/
+static unsigned int addSideNode(struct searchSide *side, boardKey key, unsigned int parent, int direction, int blankIndex)
+{
+	struct searchNode *newNode;						//node being added
+	unsigned int index;							//index it will get
+
+	index = (unsigned int) side->nodes.recordCount;
+
+	if(insertPositionValue(side->seen, key, index) != NOPOSITIONVALUE)
+	{
+		return NOPOSITIONVALUE;
+	}
+
+	newNode = arenaAllocate(&side->nodes);
+	newNode->key = key;
+	newNode->parent = parent;
+	newNode->direction = (unsigned char) direction;
+	newNode->blankIndex = (unsigned char) blankIndex;
+
+	return index;
+}
+
+/**
+*Name: initializeSide
+*Purpose: This function will, given a side and its root board, set the side
+	up with the root as its only node and its current level.
+*Parameters:
+*	side --side to set up
+	key --key of the root board
+	blankIndex --1d index of the blank on it
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+static void initializeSide(struct searchSide *side, boardKey key, int blankIndex)
+{
+	initializeArena(&side->nodes, sizeof(struct searchNode), NODESPERCHUNK);
+	side->seen = createHashMap(INITIALHASHCAPACITY);
+	side->levelStart = addSideNode(side, key, ROOTPARENT, NOMOVE, blankIndex);
+	side->levelEnd = side->levelStart + 1;
+	side->depth = 0;
+}
+
+/**
+*Name: releaseSide
+*Purpose: This function will free the nodes and the map of a side.
+*Parameters:
+*	side --side to release
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+static void releaseSide(struct searchSide *side)
+{
+	releaseArena(&side->nodes);
+	destroyHashList(side->seen);
+}
+
+/**
+*Name: expandSideLevel
+*Purpose: This function will expand every node of a side's current level,
+	skipping the move straight back to each node's parent, and look every
+	new board up in the other side. If one is there it stops and gives back
+	the two nodes that hold it, if not the new nodes become the current level.
+	A path the level can find is one move longer than both sides' depths, that
+	is the depth the search limits are charged with.
+*Parameters:
+*	side --side to grow
+	other --the other side
+	sideIndex --FORWARDSIDE or BACKWARDSIDE, for the counts
+	meetHere --filled with the index of the meeting node on side
+	meetOther --filled with the index of the meeting node on other
+*Returns:
+	1 if the sides met
+	0 if not
+	-1 if the side has no nodes left to expand
+	LIMITREACHED if a search limit was reached
+*Author: Andrew Gendreau
+**/
+static int expandSideLevel(struct searchSide *side, struct searchSide *other, int sideIndex,
+	unsigned int *meetHere, unsigned int *meetOther)
+{
+	struct searchNode *currentNode;						//node we are expanding
+	boardKey key;								//key of the node
+	boardKey childKey;							//key of the board after a move
+	unsigned int nodeIndex;							//index of the node we are expanding
+	unsigned int childIndex;						//index of the child we added
+	unsigned int otherIndex;						//index of the child's board on the other side
+	int blankIndex;								//index of the blank on the node's board
+	int backwards;								//direction that would undo the move into the node
+	int i;									//loop control variable
+
+	if(side->levelStart == side->levelEnd)
+	{
+		return -1;
+	}
+
+	if(chargeSearchLimits(0, side->depth + other->depth + 1) != LIMITNONE)
+	{
+		return LIMITREACHED;
+	}
+
+	for(nodeIndex = side->levelStart; nodeIndex < side->levelEnd; nodeIndex++)
+	{
+		currentNode = arenaRecord(&side->nodes, nodeIndex);
+		key = currentNode->key;
+		blankIndex = currentNode->blankIndex;
+		backwards = (currentNode->direction == (unsigned char) NOMOVE) ? NOMOVE : currentNode->direction ^ 1;
+
+		sideNodesExpanded[sideIndex]++;
+
+		if(sideNodesExpanded[sideIndex] % LIMITCHECKNODES == 0
+			&& chargeSearchLimits(LIMITCHECKNODES, side->depth + other->depth + 1) != LIMITNONE)
+		{
+			return LIMITREACHED;
+		}
+
+		for(i = 0; i < movesForBlank[blankIndex]; i++)
+		{
+			if(directionsForBlank[blankIndex][i] == backwards)
+			{
+				continue;
+			}
+
+			childKey = applyMoveToKey(key, blankIndex, tilesForBlank[blankIndex][i]);
+			childIndex = addSideNode(side, childKey, nodeIndex, directionsForBlank[blankIndex][i],
+				tilesForBlank[blankIndex][i]);
+
+			if(childIndex == NOPOSITIONVALUE)
+			{
+				continue;
+			}
+
+			otherIndex = findPositionValue(other->seen, childKey);
+
+			if(otherIndex != NOPOSITIONVALUE)
+			{
+				*meetHere = childIndex;
+				*meetOther = otherIndex;
+				return 1;
+			}
+		}
+	}
+
+	side->levelStart = side->levelEnd;
+	side->levelEnd = (unsigned int) side->nodes.recordCount;
+	side->depth++;
+
+	return 0;
+}
+
+/**
+*Name: stitchPath
+*Purpose: This function will, given the node where the two sides met on each
+	side, fill path with the moves from the forward root to that board, found
+	by walking up the forward side and turning the moves around, followed by
+	the moves from that board to the winning board, found by walking up the
+	backward side and undoing each of its moves in turn.
+*Parameters:
+*	forward --the forward side
+	forwardIndex --index of the meeting node on the forward side
+	backward --the backward side
+	backwardIndex --index of the meeting node on the backward side
+	path --path to fill
+*Returns:
+	the number of moves on the path
+	-1 if the path is longer than MAXPATHLENGTH
+*Author: Andrew Gendreau
+**/
+static int stitchPath(struct searchSide *forward, unsigned int forwardIndex, struct searchSide *backward,
+	unsigned int backwardIndex, struct movePath *path)
+{
+	struct searchNode *currentNode;						//node we are looking at
+	struct searchNode *parentNode;						//its parent
+	moveCode temp;								//temporary storage for turning the path around
+	int i;									//loop control variable
+
+	path->length = 0;
+
+	for(currentNode = arenaRecord(&forward->nodes, forwardIndex); currentNode->parent != ROOTPARENT;
+		currentNode = parentNode)
+	{
+		if(path->length == MAXPATHLENGTH)
+		{
+			return -1;
+		}
+
+		parentNode = arenaRecord(&forward->nodes, currentNode->parent);
+		path->moves[path->length] = MOVECODE(KEYTILE(currentNode->key, parentNode->blankIndex),
+			currentNode->direction);
+		path->length++;
+	}
+
+	for(i = 0; i < path->length / 2; i++)
+	{
+		temp = path->moves[i];
+		path->moves[i] = path->moves[path->length - 1 - i];
+		path->moves[path->length - 1 - i] = temp;
+	}
+
+	for(currentNode = arenaRecord(&backward->nodes, backwardIndex); currentNode->parent != ROOTPARENT;
+		currentNode = parentNode)
+	{
+		if(path->length == MAXPATHLENGTH)
+		{
+			return -1;
+		}
+
+		parentNode = arenaRecord(&backward->nodes, currentNode->parent);
+		path->moves[path->length] = MOVECODE(KEYTILE(currentNode->key, parentNode->blankIndex),
+			currentNode->direction ^ 1);
+		path->length++;
+	}
+
+	return path->length;
+}
+
+/**
+*Name: bidirectionalSolve
+*Purpose: This function will, given a solvable board, find a shortest path
+	to the winning state by growing a breadth first search from each end,
+	a level at a time, always the side with the smaller current level, until
+	a board made by one side has already been made by the other. If a search
+	limit stops it no path is shorter than one more than the two sides' depths.
+*Parameters:
+*	board --1d array containing the game board
+	path --path to fill
+*Returns:
+	the number of moves on the path
+	-1 if there is no path of MAXPATHLENGTH moves or fewer
+	LIMITREACHED if a search limit was reached
+*Author: Andrew Gendreau
+**/
+int bidirectionalSolve(int board[BOARDSIZE], struct movePath *path)
+{
+	struct searchSide sides[2];						//the forward and backward searches
+	unsigned int meetHere;							//meeting node on the side grown
+	unsigned int meetOther;							//meeting node on the other side
+	boardKey rootKey;							//key of the board we were given
+	int grow;								//side being grown
+	int result;								//what growing it returned
+	int length;								//length of the path found
+
+	rootKey = encodeBoard(board);
+	path->length = 0;
+	sideNodesExpanded[FORWARDSIDE] = 0;
+	sideNodesExpanded[BACKWARDSIDE] = 0;
+
+	if(rootKey == WINNINGHASH)
+	{
+		return 0;
+	}
+
+	initializeSide(&sides[FORWARDSIDE], rootKey, findBlankIndex(board));
+	initializeSide(&sides[BACKWARDSIDE], WINNINGHASH, BOARDSIZE - 1);
+
+	length = -1;
+	result = 0;
+	grow = FORWARDSIDE;
+
+	while(result == 0 && sides[FORWARDSIDE].depth + sides[BACKWARDSIDE].depth < MAXPATHLENGTH)
+	{
+		if(sides[FORWARDSIDE].levelEnd - sides[FORWARDSIDE].levelStart
+			<= sides[BACKWARDSIDE].levelEnd - sides[BACKWARDSIDE].levelStart)
+		{
+			grow = FORWARDSIDE;
+		}
+		else
+		{
+			grow = BACKWARDSIDE;
+		}
+
+		result = expandSideLevel(&sides[grow], &sides[1 - grow], grow, &meetHere, &meetOther);
+	}
+
+	if(result == 1 && grow == FORWARDSIDE)
+	{
+		length = stitchPath(&sides[FORWARDSIDE], meetHere, &sides[BACKWARDSIDE], meetOther, path);
+	}
+	else if(result == 1)
+	{
+		length = stitchPath(&sides[FORWARDSIDE], meetOther, &sides[BACKWARDSIDE], meetHere, path);
+	}
+	else if(result == LIMITREACHED)
+	{
+		length = stopAtLimit(sides[FORWARDSIDE].depth + sides[BACKWARDSIDE].depth + 1);
+	}
+
+	releaseSide(&sides[FORWARDSIDE]);
+	releaseSide(&sides[BACKWARDSIDE]);
+
+	return length;
+}
+
+/**
+*Name: runBidirectional
+*Purpose: This function will, given a 1d array that represents the inital board state,
+	solve it with bidirectionalSolve and print the length of the path, its moves,
+	how many nodes were expanded on each side and the most heap held at once, or
+	the search limit that stopped it.
+*Parameters:
+	board --1d Int array to hold the root board
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void runBidirectional(int board[BOARDSIZE])
+{
+	struct movePath winningPath;						//the moves from the root to the goal
+	char winningMoves[PATHTEXTSIZE];					//text of those moves
+	int length;								//what the solve returned
+
+	if(encodeBoard(board) == WINNINGHASH)
+	{
+		printf("You gave me a winning state!\n");
+		return;
+	}
+
+	length = bidirectionalSolve(board, &winningPath);
+
+	if(length == LIMITREACHED)
+	{
+		reportSearchLimit();
+		printf("Peak heap use was %lu bytes\n", (unsigned long) memoryUsage.peakBytes);
+		return;
+	}
+
+	if(length < 0)
+	{
+		printf("There is no solution in %d moves or fewer\n", MAXPATHLENGTH);
+		return;
+	}
+
+	formatMovePath(&winningPath, winningMoves);
+
+	printf("It took %d moves\n", winningPath.length);
+	printf("The moves were: %s\n", winningMoves);
+	printf("Expanded %llu nodes, %llu forward and %llu backward\n",
+		sideNodesExpanded[FORWARDSIDE] + sideNodesExpanded[BACKWARDSIDE],
+		sideNodesExpanded[FORWARDSIDE], sideNodesExpanded[BACKWARDSIDE]);
+	printf("Peak heap use was %lu bytes\n", (unsigned long) memoryUsage.peakBytes);
+}
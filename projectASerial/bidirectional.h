@@ -0,0 +1,66 @@
+/*NAME: bidirectional.h
+DATE: Oct 17th 2026
+VERSION: 1.0
+FILENAME: bidirectional.h
+PURPOSE: This is a header for bidirectional.c
+AUTHOR: Andrew Gendreau
+*/
+
+#ifndef SEARCHTREE_H_
+#define SEARCHTREE_H_
+#include "searchTree.h"
+#endif
+
+#ifndef HASH_H_
+#define HASH_H_
+#include "hashList.h"
+#endif
+
+#define FORWARDSIDE 0						//the side grown from the board we were given
+#define BACKWARDSIDE 1						//the side grown from the winning board
+
+/*
+	This is a struct for one side of a bidirectional search. It is its own
+	breadth first search, with its nodes in an arena, a map from the key of
+	every board it has made to the index of its node, and the current level
+	as a run of indices, the same way the forward search keeps its levels.
+*/
+struct searchSide
+{
+	struct nodeArena nodes;					//the searchNodes of this side
+	struct hashList *seen;					//key of every board made, mapped to its node index
+	unsigned int levelStart;				//index of the first node of the current level
+	unsigned int levelEnd;					//index one past the last node of the current level
+	int depth;						//moves from this side's root to the current level
+};
+
+/**
+*Name: bidirectionalSolve
+*Purpose: This function will, given a solvable board, find a shortest path
+	to the winning state by growing a breadth first search from each end,
+	a level at a time, always the side with the smaller current level, until
+	a board made by one side has already been made by the other.
+*Parameters:
+*	board --1d array containing the game board
+	path --path to fill
+*Returns:
+	the number of moves on the path
+	-1 if there is no path of MAXPATHLENGTH moves or fewer
+	LIMITREACHED if a search limit was reached
+*Author: Andrew Gendreau
+**/
+int bidirectionalSolve(int board[BOARDSIZE], struct movePath *path);
+
+/**
+*Name: runBidirectional
+*Purpose: This function will, given a 1d array that represents the inital board state,
+	solve it with bidirectionalSolve and print the length of the path, its moves,
+	how many nodes were expanded on each side and the most heap held at once, or
+	the search limit that stopped it.
+*Parameters:
+	board --1d Int array to hold the root board
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void runBidirectional(int board[BOARDSIZE]);
@@ -0,0 +1,199 @@
+/*NAME: concurrentSet.c
+DATE: Oct 17th 2026
+VERSION: 1.0
+FILENAME: concurrentSet.c
+PURPOSE: This module will be the set of boards seen that the threads of the
+	parallel breadth first search share. The hashList is only ever used by one
+	thread, and putting a lock around it makes every thread wait on every other.
+	Here the slots are atomic and a key is added with a single compare and swap
+	of an empty slot for the key. If the swap fails another thread has just
+	filled that slot, and the value it put there is handed back by the swap, so
+	if it is our key the board has been seen and if not the probe goes on to the
+	next slot. A slot is never emptied once filled, so a probe that reaches an
+	empty slot knows the key is not in the set, and the one swap both checks for
+	the key and inserts it.
+	Growing the set while threads are probing it would need them all to help
+	move the keys, so instead it never grows during an insert. The search knows
+	how many nodes the level it is about to expand has, each of which can make
+	at most three new children, so it reserves room for that many before the level
+	starts, while none of the workers are running.
+AUTHOR: Andrew Gendreau
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifndef CONCURRENTSET_H_
+#define CONCURRENTSET_H_
+#include "concurrentSet.h"
+#endif
+
+#ifndef MEMORY_H_
+#define MEMORY_H_
+#include "memoryTracker.h"
+#endif
+
+/**
+*Name: capacityFor
+*Purpose: This function will, given a number of keys, find the smallest power
+	of two number of slots that holds them without being more than
+	MAXLOADNUMERATOR / MAXLOADDENOMINATOR full.
+*Parameters:
+*	keys --number of keys
+*Returns:
+	the number of slots
+*Author: Andrew Gendreau
+**/
+static unsigned long capacityFor(unsigned long keys)
+{
+	unsigned long capacity;							//capacity being tried
+
+	capacity = INITIALHASHCAPACITY;
+
+	while(keys * MAXLOADDENOMINATOR > capacity * MAXLOADNUMERATOR)
+	{
+		capacity = capacity * 2;
+	}
+
+	return capacity;
+}
+
+/**
+*Name: createConcurrentSet
+*Purpose: This function will create an empty concurrent set with room for at
+	least the given number of keys before it is more than MAXLOADNUMERATOR /
+	MAXLOADDENOMINATOR full.
+*Parameters:
+*	expectedKeys --keys it should have room for
+*Returns:
+	pointer to the set
+*Author: Andrew Gendreau
+**/
+struct concurrentSet *createConcurrentSet(unsigned long expectedKeys)
+{
+	struct concurrentSet *set;						//set to be returned
+
+	set = trackedMalloc(sizeof(struct concurrentSet));
+	set->capacity = capacityFor(expectedKeys);
+	set->slots = trackedCalloc(set->capacity, sizeof(boardKey));		//calloc so every slot starts as EMPTYSLOT
+	atomic_init(&set->count, 0);
+
+	return set;
+}
+
+/**
+*Name: insertConcurrent
+*Purpose: This function will, given a concurrent set and a hash value, probe
+	the set for it and put it in the first empty slot if it is not there, from
+	any thread. Checking and inserting is the one compare and swap on that slot.
+*Parameters:
+*	set --set to insert into
+	hashVal --hash value to insert
+*Returns:
+	1 if it was already there
+	-1 if it was inserted
+	CONCURRENTFULL if every slot is taken by another key
+*Author: Andrew Gendreau
+**/
+int insertConcurrent(struct concurrentSet *set, boardKey hashVal)
+{
+	unsigned long slot;							//slot being probed
+	unsigned long probes;							//slots probed so far
+	boardKey found;								//what the slot holds
+
+	slot = homeSlot(hashVal, set->capacity);
+
+	for(probes = 0; probes < set->capacity; probes++)
+	{
+		found = atomic_load_explicit(&set->slots[slot], memory_order_relaxed);
+
+		if(found == EMPTYSLOT)
+		{
+			if(atomic_compare_exchange_strong(&set->slots[slot], &found, hashVal))
+			{
+				atomic_fetch_add_explicit(&set->count, 1, memory_order_relaxed);
+				return -1;
+			}
+		}
+
+		if(found == hashVal)						//there already, or another thread just put it there
+		{
+			return 1;
+		}
+
+		slot = (slot + 1) & (set->capacity - 1);
+	}
+
+	return CONCURRENTFULL;
+}
+
+/**
+*Name: reserveConcurrent
+*Purpose: This function will, given a concurrent set and a number of keys,
+	grow the set if it does not have room for that many more. The new slot
+	array is filled by placing every stored key into it again, since the home
+	slots change with the capacity. It must only be called while no other
+	thread is using the set.
+*Parameters:
+*	set --set to grow
+	moreKeys --number of keys about to be inserted
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void reserveConcurrent(struct concurrentSet *set, unsigned long moreKeys)
+{
+	_Atomic boardKey *oldSlots;						//slot array being replaced
+	unsigned long oldCapacity;						//number of slots in it
+	unsigned long newCapacity;						//number of slots needed
+	unsigned long slot;							//slot being probed in the new array
+	unsigned long i;							//loop control variable
+	boardKey key;								//key being moved
+
+	newCapacity = capacityFor(atomic_load(&set->count) + moreKeys);
+
+	if(newCapacity <= set->capacity)
+	{
+		return;
+	}
+
+	oldSlots = set->slots;
+	oldCapacity = set->capacity;
+
+	set->slots = trackedCalloc(newCapacity, sizeof(boardKey));
+	set->capacity = newCapacity;
+
+	for(i = 0; i < oldCapacity; i++)
+	{
+		key = atomic_load_explicit(&oldSlots[i], memory_order_relaxed);
+
+		if(key != EMPTYSLOT)
+		{
+			slot = homeSlot(key, newCapacity);
+
+			while(atomic_load_explicit(&set->slots[slot], memory_order_relaxed) != EMPTYSLOT)
+			{
+				slot = (slot + 1) & (newCapacity - 1);
+			}
+
+			atomic_store_explicit(&set->slots[slot], key, memory_order_relaxed);
+		}
+	}
+
+	trackedFree((void *) oldSlots, oldCapacity * sizeof(boardKey));
+}
+
+/**
+*Name: destroyConcurrentSet
+*Purpose: This function will free the slots of a concurrent set and the set.
+*Parameters:
+*	set --set to free
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void destroyConcurrentSet(struct concurrentSet *set)
+{
+	trackedFree((void *) set->slots, set->capacity * sizeof(boardKey));
+	trackedFree(set, sizeof(struct concurrentSet));
+}
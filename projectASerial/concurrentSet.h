@@ -0,0 +1,84 @@
+/*NAME: concurrentSet.h
+DATE: Oct 17th 2026
+VERSION: 1.0
+FILENAME: concurrentSet.h
+PURPOSE: This is a header for concurrentSet.c
+AUTHOR: Andrew Gendreau
+*/
+
+#include <stdatomic.h>
+
+#ifndef HASH_H_
+#define HASH_H_
+#include "hashList.h"
+#endif
+
+#define CONCURRENTFULL 0					//returned by an insert that found no empty slot
+
+/*
+	This is a struct for a hash set many threads can insert into at once. It is
+	laid out like a hashList, one power of two array of slots probed linearly,
+	but every slot is atomic and a key is put in one with a compare and swap.
+	It does not grow by itself, reserveConcurrent has to make room for the keys
+	about to be inserted while no thread is inserting.
+*/
+struct concurrentSet
+{
+	_Atomic boardKey *slots;				//array of capacity slots holding board keys or EMPTYSLOT
+	unsigned long capacity;					//number of slots, always a power of two
+	atomic_ulong count;					//number of keys stored in the set
+};
+
+/**
+*Name: createConcurrentSet
+*Purpose: This function will create an empty concurrent set with room for at
+	least the given number of keys before it is more than MAXLOADNUMERATOR /
+	MAXLOADDENOMINATOR full.
+*Parameters:
+*	expectedKeys --keys it should have room for
+*Returns:
+	pointer to the set
+*Author: Andrew Gendreau
+**/
+struct concurrentSet *createConcurrentSet(unsigned long expectedKeys);
+
+/**
+*Name: insertConcurrent
+*Purpose: This function will, given a concurrent set and a hash value, probe
+	the set for it and put it in the first empty slot if it is not there, from
+	any thread. Checking and inserting is the one compare and swap on that slot.
+*Parameters:
+*	set --set to insert into
+	hashVal --hash value to insert
+*Returns:
+	1 if it was already there
+	-1 if it was inserted
+	CONCURRENTFULL if every slot is taken by another key
+*Author: Andrew Gendreau
+**/
+int insertConcurrent(struct concurrentSet *set, boardKey hashVal);
+
+/**
+*Name: reserveConcurrent
+*Purpose: This function will, given a concurrent set and a number of keys,
+	grow the set if it does not have room for that many more. It must only be
+	called while no other thread is using the set.
+*Parameters:
+*	set --set to grow
+	moreKeys --number of keys about to be inserted
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void reserveConcurrent(struct concurrentSet *set, unsigned long moreKeys);
+
+/**
+*Name: destroyConcurrentSet
+*Purpose: This function will free the slots of a concurrent set and the set.
+*Parameters:
+*	set --set to free
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void destroyConcurrentSet(struct concurrentSet *set);
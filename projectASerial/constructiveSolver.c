@@ -0,0 +1,322 @@
+/*NAME: constructiveSolver.c
+DATE: Oct 17th 2026
+VERSION: 1.0
+FILENAME: constructiveSolver.c
+PURPOSE: This module will be the constructive engine, for when any path to the
+	goal will do and it is wanted for a great many boards. It solves a board
+	the way a person does, the top row first, then the second, then the last
+	two rows a column at a time from the left, and the 2x2 square left over
+	last. Each step puts one tile or a pair of tiles in place and never moves
+	the cells already done again, so there is no search of the puzzle and no
+	table, and a board takes microseconds.
+	A step is found with a breadth first search over only the cells of the
+	tiles it places and of the blank, at most 16 to the power of 3 of them,
+	never moving the blank into a cell that is done. That finds the fewest
+	moves for the step and never gets stuck, where pushing a tile along by
+	hand can. The last two tiles of a row, and the two of a column, are
+	placed together, since the second can not be put next to the first
+	once the first is kept in place. Searching for a pair from anywhere is
+	slow, so each tile of it is first moved where it goes on its own,
+	without being kept, and the pair search is left to fix the boards
+	where putting the second in place moved the first back out.
+	The path is usually two or three times as long as a shortest one. Moves
+	that are undone by the move after them, where one step ends and the next
+	starts, can be taken out after with removeRedundantPairs.
+AUTHOR: Andrew Gendreau
+*/
+
+#include <stdio.h>
+#include <string.h>
+
+#ifndef CONSTRUCTIVE_H_
+#define CONSTRUCTIVE_H_
+#include "constructiveSolver.h"
+#endif
+
+#ifndef SOLVER_H_
+#define SOLVER_H_
+#include "puzzleSolver.h"
+#endif
+
+int constructivePrune = 0;							//1 to take the redundant pairs out of the path
+
+struct placement placements[PLACEMENTCOUNT] =					//steps of a solve, in order
+{
+	{1, {1}, {0}, 1},
+	{1, {2}, {1}, 1},
+	{1, {4}, {3}, 0},							//the end of the top row one at a time
+	{1, {3}, {2}, 0},
+	{2, {3, 4}, {2, 3}, 1},							//and then into place together
+	{1, {5}, {4}, 1},
+	{1, {6}, {5}, 1},
+	{1, {8}, {7}, 0},							//the end of the second row
+	{1, {7}, {6}, 0},
+	{2, {7, 8}, {6, 7}, 1},
+	{1, {13}, {12}, 0},							//the first column of the last two rows
+	{1, {9}, {8}, 0},
+	{2, {9, 13}, {8, 12}, 1},
+	{1, {14}, {13}, 0},							//the second
+	{1, {10}, {9}, 0},
+	{2, {10, 14}, {9, 13}, 1},
+	{2, {11, 12}, {10, 11}, 1},						//the top of the last 2x2 square
+	{1, {15}, {14}, 1}							//and the blank into the corner
+};
+
+unsigned short placementParent[PLACEMENTSTATES];				//state each state was reached from
+unsigned char placementMove[PLACEMENTSTATES];					//entry of the move tables that reached it
+unsigned int placementSeen[PLACEMENTSTATES];					//search each state was last reached in
+unsigned short placementQueue[PLACEMENTSTATES];					//states waiting to be expanded
+unsigned char placementRoute[PLACEMENTSTATES];					//the moves of a step, last first
+unsigned int placementSearch = 0;						//number of the current search
+
+/**
+*Name: placeTiles
+*Purpose: This function will, given a board, the cells that are done and a
+	step, find the fewest moves that put the step's tiles where they go
+	without the blank going into a cell that is done, make them on the board,
+	add them to the path and, if the step keeps them, mark the cells the
+	tiles went to as done.
+	A state of the search is the cell of the blank in the low 4 bits and the
+	cell of each tile in the 4 bits above.
+*Parameters:
+*	board --board to make the moves on
+	blank --1d index of the blank, moved with it
+	done --1 for every cell that is done
+	step --the tiles to place and where they go
+	path --path to add the moves to
+*Returns:
+	0 if the tiles were placed
+	-1 if they could not be, or the path ran out of room
+*Author: Andrew Gendreau
+**/
+static int placeTiles(int board[BOARDSIZE], int *blank, unsigned char done[BOARDSIZE], struct placement *step,
+	struct constructivePath *path)
+{
+	unsigned int state;							//state being expanded
+	unsigned int next;							//state a move from it reaches
+	unsigned int goal;							//state the tiles are where they go in
+	unsigned int goalMask;							//bits of the tiles' cells
+	int head;								//next state to take off the queue
+	int tail;								//one past the last state on it
+	int routeLength;							//moves of the step
+	int blankCell;								//cell of the blank in a state
+	int cell;								//cell the blank moves to
+	int i;									//loop control variable
+	int k;									//loop control variable
+
+	state = *blank;
+	goal = 0;
+	goalMask = 0;
+
+	for(k = 0; k < step->tileCount; k++)
+	{
+		for(i = 0; board[i] != step->tiles[k]; i++)
+		{
+		}
+
+		state |= i << (4 * (k + 1));
+		goal |= step->targets[k] << (4 * (k + 1));
+		goalMask |= 15 << (4 * (k + 1));
+	}
+
+	placementSearch++;
+	placementSeen[state] = placementSearch;
+	placementQueue[0] = state;
+	head = 0;
+	tail = 1;
+
+	while((state & goalMask) != goal)
+	{
+		if(head == tail)
+		{
+			return -1;
+		}
+
+		state = placementQueue[head];
+		head++;
+		blankCell = state & 15;
+
+		for(i = 0; i < movesForBlank[blankCell] && (state & goalMask) != goal; i++)
+		{
+			cell = tilesForBlank[blankCell][i];
+
+			if(done[cell] == 1)
+			{
+				continue;
+			}
+
+			next = (state & ~15U) | cell;
+
+			for(k = 0; k < step->tileCount; k++)
+			{
+				if(((next >> (4 * (k + 1))) & 15) == (unsigned int) cell)	//that tile moves into the blank's cell
+				{
+					next = (next & ~(15U << (4 * (k + 1)))) | (blankCell << (4 * (k + 1)));
+				}
+			}
+
+			if(placementSeen[next] == placementSearch)
+			{
+				continue;
+			}
+
+			placementSeen[next] = placementSearch;
+			placementParent[next] = state;
+			placementMove[next] = i;
+			placementQueue[tail] = next;
+			tail++;
+
+			if((next & goalMask) == goal)
+			{
+				state = next;
+			}
+		}
+	}
+
+	routeLength = 0;
+
+	while(state != placementQueue[0])
+	{
+		placementRoute[routeLength] = placementMove[state];
+		routeLength++;
+		state = placementParent[state];
+	}
+
+	if(path->length + routeLength > MAXCONSTRUCTIVELENGTH)
+	{
+		return -1;
+	}
+
+	for(i = routeLength - 1; i >= 0; i--)
+	{
+		cell = tilesForBlank[*blank][placementRoute[i]];
+		path->moves[path->length] = MOVECODE(board[cell], directionsForBlank[*blank][placementRoute[i]]);
+		path->length++;
+		swap(*blank, cell, board);
+		*blank = cell;
+	}
+
+	for(k = 0; k < step->tileCount; k++)
+	{
+		done[step->targets[k]] = step->keep;
+	}
+
+	return 0;
+}
+
+/**
+*Name: constructiveSolve
+*Purpose: This function will, given a solvable board, find a path to the winning
+	state without a search of the puzzle, solving the top row, then the second,
+	then the bottom two rows a column at a time and the last 2x2 square.
+*Parameters:
+*	board --1d array containing the game board, it is not changed
+	path --path to fill
+*Returns:
+	the number of moves on the path
+	-1 if the board could not be solved
+*Author: Andrew Gendreau
+**/
+int constructiveSolve(int board[BOARDSIZE], struct constructivePath *path)
+{
+	int currentBoard[BOARDSIZE];						//board the moves are made on
+	unsigned char done[BOARDSIZE];						//1 for every cell that is done
+	int blank;								//1d index of the blank
+	int p;									//loop control variable
+
+	memcpy(currentBoard, board, sizeof(currentBoard));
+	memset(done, 0, sizeof(done));
+	blank = findBlankIndex(currentBoard);
+	path->length = 0;
+
+	for(p = 0; p < PLACEMENTCOUNT; p++)
+	{
+		if(placeTiles(currentBoard, &blank, done, &placements[p], path) < 0)
+		{
+			return -1;
+		}
+	}
+
+	return path->length;
+}
+
+/**
+*Name: removeRedundantPairs
+*Purpose: This function will, given a path, take out every move that is undone
+	by the move right after it, and every pair that comes next to each other
+	once those are gone, in one pass. The moves kept are stacked at the front
+	of the path, and a move that undoes the top of the stack pops it.
+*Parameters:
+*	path --path to shorten
+*Returns:
+	the number of moves taken out
+*Author: Andrew Gendreau
+**/
+int removeRedundantPairs(struct constructivePath *path)
+{
+	int kept;								//moves kept so far
+	int removed;								//moves taken out
+	int i;									//loop control variable
+
+	kept = 0;
+
+	for(i = 0; i < path->length; i++)
+	{
+		if(kept > 0 && CODETILE(path->moves[kept - 1]) == CODETILE(path->moves[i])
+			&& CODEDIRECTION(path->moves[kept - 1]) == (CODEDIRECTION(path->moves[i]) ^ 1))
+		{
+			kept--;								//the same tile going back where it was
+		}
+		else
+		{
+			path->moves[kept] = path->moves[i];
+			kept++;
+		}
+	}
+
+	removed = path->length - kept;
+	path->length = kept;
+
+	return removed;
+}
+
+/**
+*Name: runConstructive
+*Purpose: This function will, given a 1d array that represents the inital board state,
+	solve it with constructiveSolve, take out the redundant pairs if constructivePrune
+	is 1, and print the length of the path and its moves.
+*Parameters:
+	board --1d Int array to hold the root board
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void runConstructive(int board[BOARDSIZE])
+{
+	struct constructivePath winningPath;					//the moves from the root to the goal
+	char winningMoves[CONSTRUCTIVETEXTSIZE];				//text of those moves
+	int removed;								//moves taken out by removeRedundantPairs
+
+	if(givenAWinner(encodeBoard(board)) == 1)
+	{
+		return;
+	}
+
+	if(constructiveSolve(board, &winningPath) < 0)
+	{
+		printf("The board could not be solved in %d moves or fewer\n", MAXCONSTRUCTIVELENGTH);
+		return;
+	}
+
+	if(constructivePrune == 1)
+	{
+		removed = removeRedundantPairs(&winningPath);
+		printf("Took out %d moves that were undone right after\n", removed);
+	}
+
+	formatMoveCodes(winningPath.moves, winningPath.length, winningMoves);
+
+	printf("It took %d moves\n", winningPath.length);
+	printf("The moves were: %s\n", winningMoves);
+	printf("The path is not always a shortest one\n");
+}
@@ -0,0 +1,81 @@
+/*NAME: constructiveSolver.h
+DATE: Oct 17th 2026
+VERSION: 1.0
+FILENAME: constructiveSolver.h
+PURPOSE: This is a header for constructiveSolver.c
+AUTHOR: Andrew Gendreau
+*/
+
+#ifndef MOVEPATH_H_
+#define MOVEPATH_H_
+#include "movePath.h"
+#endif
+
+#define MAXCONSTRUCTIVELENGTH 512				//most moves a constructive path can take
+#define CONSTRUCTIVETEXTSIZE (MAXCONSTRUCTIVELENGTH * MOVETEXTSIZE + 1)	//characters the text of the longest can take
+#define MAXPLACEDTILES 2					//most tiles placed by one placement
+#define PLACEMENTSTATES (1 << (4 * (MAXPLACEDTILES + 1)))	//a 4 bit index for each tile and the blank
+#define PLACEMENTCOUNT 18					//placements it takes to solve a board
+
+/*
+	This is a struct for the moves a constructive solve makes, like a
+	movePath but with room for the longer paths it finds.
+*/
+struct constructivePath
+{
+	int length;						//number of moves on the path
+	moveCode moves[MAXCONSTRUCTIVELENGTH];			//the moves, first to last
+};
+
+/*
+	This is a struct for one step of a constructive solve, the tiles it
+	puts in place, where they go and if they are kept there from then on.
+*/
+struct placement
+{
+	int tileCount;						//number of tiles placed
+	int tiles[MAXPLACEDTILES];				//the tiles
+	int targets[MAXPLACEDTILES];				//1d index each goes to
+	int keep;						//1 if the cells are done once they are placed
+};
+
+/**
+*Name: constructiveSolve
+*Purpose: This function will, given a solvable board, find a path to the winning
+	state without a search of the puzzle, solving the top row, then the second,
+	then the bottom two rows a column at a time and the last 2x2 square.
+*Parameters:
+*	board --1d array containing the game board, it is not changed
+	path --path to fill
+*Returns:
+	the number of moves on the path
+	-1 if the board could not be solved
+*Author: Andrew Gendreau
+**/
+int constructiveSolve(int board[BOARDSIZE], struct constructivePath *path);
+
+/**
+*Name: removeRedundantPairs
+*Purpose: This function will, given a path, take out every move that is undone
+	by the move right after it, and every pair that comes next to each other
+	once those are gone, in one pass.
+*Parameters:
+*	path --path to shorten
+*Returns:
+	the number of moves taken out
+*Author: Andrew Gendreau
+**/
+int removeRedundantPairs(struct constructivePath *path);
+
+/**
+*Name: runConstructive
+*Purpose: This function will, given a 1d array that represents the inital board state,
+	solve it with constructiveSolve, take out the redundant pairs if constructivePrune
+	is 1, and print the length of the path and its moves.
+*Parameters:
+	board --1d Int array to hold the root board
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void runConstructive(int board[BOARDSIZE]);
@@ -0,0 +1,598 @@
+/*NAME: endgameTable.c
+DATE: Oct 17th 2026
+VERSION: 1.0
+FILENAME: endgameTable.c
+PURPOSE: This module will be the endgame table, every board within a set number
+	of moves of the goal with its distance and the move that takes it one step
+	closer. It is made once by a breadth first search back from the goal with
+		./mys15p endgame 18
+	and written to a file. Only when that file is given with -T does the solver
+	map it read only, like the pattern databases, and look the board it is given
+	up first, so an engine is never bypassed unless that is asked for. A board
+	in the table is answered by following its best move to the next board and
+	looking that one up, down to the goal, a binary search per move, so no
+	search is run at all. Any other board goes to the chosen engine as before.
+	The keys are stored in increasing order so they can be binary searched in
+	place, and the distance and move of each key are packed into one byte in a
+	second array, so the keys stay packed together.
+AUTHOR: Andrew Gendreau
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#ifndef ENDGAMETABLE_H_
+#define ENDGAMETABLE_H_
+#include "endgameTable.h"
+#endif
+
+#ifndef HASH_H_
+#define HASH_H_
+#include "hashList.h"
+#endif
+
+#ifndef PATTERNFILE_H_
+#define PATTERNFILE_H_
+#include "patternFile.h"
+#endif
+
+#ifndef MEMORY_H_
+#define MEMORY_H_
+#include "memoryTracker.h"
+#endif
+
+#define INITIALENDGAMESIZE 4096						//starting number of entries the generation has room for
+
+/*
+	This is a struct for one board found while generating the table.
+*/
+struct endgameRecord
+{
+	boardKey key;								//the board
+	unsigned char entry;							//its distance and best move
+	unsigned char blankIndex;						//1d index of its blank
+};
+
+/**
+*Name: compareRecords
+*Purpose: This function will compare two endgame records by key, for qsort.
+*Parameters:
+*	first --first record
+	second --second record
+*Returns:
+	-1, 0 or 1 as the first key is less than, equal to or more than the second
+*Author: Andrew Gendreau
+**/
+static int compareRecords(const void *first, const void *second)
+{
+	boardKey firstKey;							//key of the first record
+	boardKey secondKey;							//key of the second record
+
+	firstKey = ((const struct endgameRecord *) first)->key;
+	secondKey = ((const struct endgameRecord *) second)->key;
+
+	if(firstKey < secondKey)
+	{
+		return -1;
+	}
+	else if(firstKey > secondKey)
+	{
+		return 1;
+	}
+	return 0;
+}
+
+/**
+*Name: searchBackFromGoal
+*Purpose: This function will run a breadth first search back from the goal
+	to the given depth and give back a record of every board it reaches, with
+	its distance and the move that takes it one step closer. The boards are
+	kept in the order they are found, so each level is a run of records like
+	the levels of the forward search. A board made by moving a tile in one
+	direction gets back by moving the same tile the other way, so that is its
+	best move. Every board is also put in seen, mapped to its entry byte.
+*Parameters:
+*	depth --moves from the goal to search
+	seen --empty table made with createHashMap
+	recordCount --filled with the number of records
+	recordSize --filled with the number of records there is room for
+*Returns:
+	the records, to be freed with trackedFree
+*Author: Andrew Gendreau
+**/
+static struct endgameRecord *searchBackFromGoal(int depth, struct hashList *seen, unsigned long *recordCount,
+	unsigned long *recordSize)
+{
+	struct endgameRecord *records;						//every board found
+	unsigned long count;							//number of records
+	unsigned long size;							//records there is room for
+	unsigned long levelStart;						//first record of the level being expanded
+	unsigned long levelEnd;							//one past its last record
+	unsigned long i;							//record being expanded
+	boardKey childKey;							//key of a board one move further out
+	unsigned char entry;							//distance and best move of that board
+	int level;								//distance of the level being expanded
+	int blankIndex;								//index of the blank
+	int m;									//move being made
+
+	size = INITIALENDGAMESIZE;
+	records = trackedMalloc(size * sizeof(struct endgameRecord));
+
+	records[0].key = WINNINGHASH;
+	records[0].entry = ENDGAMEENTRY(0, 0);
+	records[0].blankIndex = BOARDSIZE - 1;
+	count = 1;
+	insertPositionValue(seen, WINNINGHASH, records[0].entry);
+
+	levelStart = 0;
+	levelEnd = 1;
+
+	for(level = 0; level < depth; level++)
+	{
+		for(i = levelStart; i < levelEnd; i++)
+		{
+			blankIndex = records[i].blankIndex;
+
+			for(m = 0; m < movesForBlank[blankIndex]; m++)
+			{
+				childKey = applyMoveToKey(records[i].key, blankIndex, tilesForBlank[blankIndex][m]);
+				entry = ENDGAMEENTRY(level + 1, directionsForBlank[blankIndex][m] ^ 1);
+
+				if(insertPositionValue(seen, childKey, entry) != NOPOSITIONVALUE)
+				{
+					continue;
+				}
+
+				if(count == size)
+				{
+					records = trackedRealloc(records, size * sizeof(struct endgameRecord),
+						size * 2 * sizeof(struct endgameRecord));
+					size = size * 2;
+				}
+
+				records[count].key = childKey;
+				records[count].entry = entry;
+				records[count].blankIndex = (unsigned char) tilesForBlank[blankIndex][m];
+				count++;
+			}
+		}
+
+		levelStart = levelEnd;
+		levelEnd = count;
+	}
+
+	*recordCount = count;
+	*recordSize = size;
+	return records;
+}
+
+/**
+*Name: followBestMoves
+*Purpose: This function will, given a board held by a table or a map, add the
+	moves from it to the goal onto the end of path, by looking up each board on
+	the way and making its best move.
+*Parameters:
+*	table --table to look in, or NULL to look in map
+	map --map from buildEndgameMap to look in if table is NULL
+	key --key of the board
+	blankIndex --1d index of the blank on it
+	path --path to add to
+*Returns:
+	the number of moves on the path
+	NOTINENDGAME if a board on the way is not held
+*Author: Andrew Gendreau
+**/
+static int followBestMoves(struct endgameTable *table, struct hashList *map, boardKey key, int blankIndex,
+	struct movePath *path)
+{
+	int entry;								//entry of the board we are at
+	int tileIndex;								//index of the tile its best move moves
+	int m;									//loop control variable
+
+	while(key != WINNINGHASH)
+	{
+		if(table != NULL)
+		{
+			entry = endgameEntry(table, key);
+		}
+		else
+		{
+			entry = endgameMapEntry(map, key);
+		}
+
+		if(entry == NOTINENDGAME || path->length == MAXPATHLENGTH)
+		{
+			return NOTINENDGAME;
+		}
+
+		tileIndex = -1;
+
+		for(m = 0; m < movesForBlank[blankIndex]; m++)
+		{
+			if(directionsForBlank[blankIndex][m] == ENDGAMEDIRECTION(entry))
+			{
+				tileIndex = tilesForBlank[blankIndex][m];
+			}
+		}
+
+		if(tileIndex < 0)
+		{
+			return NOTINENDGAME;
+		}
+
+		path->moves[path->length] = MOVECODE(KEYTILE(key, tileIndex), ENDGAMEDIRECTION(entry));
+		path->length++;
+
+		key = applyMoveToKey(key, blankIndex, tileIndex);
+		blankIndex = tileIndex;
+	}
+
+	return path->length;
+}
+
+/**
+*Name: generateEndgameTable
+*Purpose: This function will run a breadth first search back from the goal
+	to the given depth and write every board it reaches, with its distance
+	and the move that takes it one step closer, to the given file. Once the
+	search is done the records are sorted by key.
+*Parameters:
+*	depth --moves from the goal to search
+	fileName --file to write
+*Returns:
+	the number of boards written
+	-1 if the file could not be written
+*Author: Andrew Gendreau
+**/
+long long generateEndgameTable(int depth, char *fileName)
+{
+	struct endgameFileHeader header;					//header of the file
+	struct endgameRecord *records;						//every board found
+	struct hashList *seen;							//keys of those boards
+	boardKey *keys;								//the keys in order, for writing
+	unsigned char *entries;							//the entries in order, for writing
+	unsigned long recordCount;						//number of records
+	unsigned long recordSize;						//records there is room for
+	unsigned long j;							//loop control variable
+	FILE *filePointer;							//file being written
+	int failed;								//1 once a write has failed
+
+	seen = createHashMap(INITIALHASHCAPACITY);
+	records = searchBackFromGoal(depth, seen, &recordCount, &recordSize);
+	destroyHashList(seen);
+
+	qsort(records, recordCount, sizeof(struct endgameRecord), compareRecords);
+
+	keys = trackedMalloc(recordCount * sizeof(boardKey));
+	entries = trackedMalloc(recordCount);
+
+	for(j = 0; j < recordCount; j++)
+	{
+		keys[j] = records[j].key;
+		entries[j] = records[j].entry;
+	}
+
+	trackedFree(records, recordSize * sizeof(struct endgameRecord));
+
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, ENDGAMEMAGIC, ENDGAMEMAGICSIZE);
+	header.version = ENDGAMEVERSION;
+	header.depth = (unsigned int) depth;
+	header.goal = WINNINGHASH;
+	header.entryCount = recordCount;
+	header.checksum = tableChecksum((unsigned char *) keys, recordCount * sizeof(boardKey))
+		^ tableChecksum(entries, recordCount);
+
+	failed = 1;
+	filePointer = fopen(fileName, "wb");
+
+	if(filePointer != NULL)
+	{
+		failed = 0;
+
+		if(fwrite(&header, sizeof(header), 1, filePointer) != 1
+			|| fwrite(keys, sizeof(boardKey), recordCount, filePointer) != recordCount
+			|| fwrite(entries, 1, recordCount, filePointer) != recordCount)
+		{
+			failed = 1;
+		}
+
+		if(fclose(filePointer) != 0)
+		{
+			failed = 1;
+		}
+
+		if(failed == 1)
+		{
+			remove(fileName);
+		}
+	}
+
+	trackedFree(keys, recordCount * sizeof(boardKey));
+	trackedFree(entries, recordCount);
+
+	if(failed == 1)
+	{
+		return -1;
+	}
+
+	return (long long) recordCount;
+}
+
+/**
+*Name: mapEndgameTable
+*Purpose: This function will, given a table and a file name, map the file read
+	only and check its header and its size. If they are right the table is
+	pointed at it. The checksum is not worked out here, it would read every
+	page of the file on every start, verifyEndgameTable does that.
+*Parameters:
+*	table --table to fill in
+	fileName --file to map
+*Returns:
+	PATTERNFILEOK if it was mapped
+	one of the other PATTERNFILE codes if not, table->mapping is then NULL
+*Author: Andrew Gendreau
+**/
+int mapEndgameTable(struct endgameTable *table, char *fileName)
+{
+	struct endgameFileHeader *header;					//header at the start of the mapping
+	struct stat fileInfo;							//size of the file
+	unsigned char *mapping;							//the whole file
+	unsigned long long keyBytes;						//size of the keys
+	int fileDescriptor;							//the open file
+	int result;								//what the checks found
+
+	table->mapping = NULL;
+
+	fileDescriptor = open(fileName, O_RDONLY);
+
+	if(fileDescriptor < 0)
+	{
+		return PATTERNFILEMISSING;
+	}
+
+	if(fstat(fileDescriptor, &fileInfo) != 0 || (size_t) fileInfo.st_size < sizeof(struct endgameFileHeader))
+	{
+		close(fileDescriptor);
+		return PATTERNFILESHORT;
+	}
+
+	mapping = mmap(NULL, (size_t) fileInfo.st_size, PROT_READ, MAP_SHARED, fileDescriptor, 0);
+	close(fileDescriptor);
+
+	if(mapping == MAP_FAILED)
+	{
+		return PATTERNFILEMISSING;
+	}
+
+	header = (struct endgameFileHeader *) mapping;
+	keyBytes = 0;
+	result = PATTERNFILEOK;
+
+	if(memcmp(header->magic, ENDGAMEMAGIC, ENDGAMEMAGICSIZE) != 0 || header->version != ENDGAMEVERSION)
+	{
+		result = PATTERNFILEFOREIGN;
+	}
+	else if(header->goal != WINNINGHASH || header->depth > MAXENDGAMEDEPTH)
+	{
+		result = PATTERNFILEMISMATCH;
+	}
+	else if(header->entryCount > ((unsigned long long) fileInfo.st_size - sizeof(struct endgameFileHeader))
+		/ (sizeof(boardKey) + 1))					//checked first, so the sizes below can not wrap
+	{
+		result = PATTERNFILESHORT;
+	}
+	else
+	{
+		keyBytes = header->entryCount * sizeof(boardKey);
+
+		if(sizeof(struct endgameFileHeader) + keyBytes + header->entryCount != (unsigned long long) fileInfo.st_size)
+		{
+			result = PATTERNFILESHORT;
+		}
+	}
+
+	if(result != PATTERNFILEOK)
+	{
+		munmap(mapping, (size_t) fileInfo.st_size);
+		return result;
+	}
+
+	table->mapping = mapping;
+	table->mappingSize = (size_t) fileInfo.st_size;
+	table->entryCount = header->entryCount;
+	table->depth = (int) header->depth;
+	table->keys = (const boardKey *) (mapping + sizeof(struct endgameFileHeader));
+	table->entries = mapping + sizeof(struct endgameFileHeader) + keyBytes;
+
+	return PATTERNFILEOK;
+}
+
+/**
+*Name: verifyEndgameTable
+*Purpose: This function will, given a mapped table, work out the checksum of
+	its keys and entries and check it against the one in its header.
+*Parameters:
+*	table --table to check, it has to be mapped
+*Returns:
+	PATTERNFILEOK if the checksum matches
+	PATTERNFILECORRUPT if it does not
+*Author: Andrew Gendreau
+**/
+int verifyEndgameTable(struct endgameTable *table)
+{
+	struct endgameFileHeader *header;					//header at the start of the mapping
+	unsigned long long keyBytes;						//size of the keys
+
+	header = (struct endgameFileHeader *) table->mapping;
+	keyBytes = table->entryCount * sizeof(boardKey);
+
+	if((tableChecksum((const unsigned char *) table->keys, keyBytes)
+		^ tableChecksum(table->entries, table->entryCount)) != header->checksum)
+	{
+		return PATTERNFILECORRUPT;
+	}
+
+	return PATTERNFILEOK;
+}
+
+/**
+*Name: endgameEntry
+*Purpose: This function will, given a table and a board key, find the board
+	with a binary search over the keys.
+*Parameters:
+*	table --table to look in
+	key --board to look for
+*Returns:
+	the entry byte of the board
+	NOTINENDGAME if the table does not hold it
+*Author: Andrew Gendreau
+**/
+int endgameEntry(struct endgameTable *table, boardKey key)
+{
+	unsigned long long low;							//first key that could still match
+	unsigned long long high;						//one past the last key that could
+	unsigned long long middle;						//key being checked
+
+	if(table->mapping == NULL)
+	{
+		return NOTINENDGAME;
+	}
+
+	low = 0;
+	high = table->entryCount;
+
+	while(low < high)
+	{
+		middle = low + (high - low) / 2;
+
+		if(table->keys[middle] < key)
+		{
+			low = middle + 1;
+		}
+		else if(table->keys[middle] > key)
+		{
+			high = middle;
+		}
+		else
+		{
+			return table->entries[middle];
+		}
+	}
+
+	return NOTINENDGAME;
+}
+
+/**
+*Name: endgamePath
+*Purpose: This function will, given a table and a board, fill path with the
+	moves to the goal by looking up each board on the way and making its best move.
+*Parameters:
+*	table --table to look in
+	board --1d array containing the game board
+	path --path to fill
+*Returns:
+	the number of moves on the path
+	NOTINENDGAME if the table does not hold the board
+*Author: Andrew Gendreau
+**/
+int endgamePath(struct endgameTable *table, int board[BOARDSIZE], struct movePath *path)
+{
+	path->length = 0;
+
+	return followBestMoves(table, NULL, encodeBoard(board), findBlankIndex(board), path);
+}
+
+/**
+*Name: buildEndgameMap
+*Purpose: This function will run the same search back from the goal as
+	generateEndgameTable, to the given depth, but keep the boards it reaches
+	in memory, in a hash map from each key to its entry byte, instead of
+	writing them out.
+*Parameters:
+*	depth --moves from the goal to search
+*Returns:
+	the map, to be freed with destroyHashList
+*Author: Andrew Gendreau
+**/
+struct hashList *buildEndgameMap(int depth)
+{
+	struct endgameRecord *records;						//every board found
+	struct hashList *map;							//their keys and entries
+	unsigned long recordCount;						//number of records
+	unsigned long recordSize;						//records there is room for
+
+	map = createHashMap(INITIALHASHCAPACITY);
+	records = searchBackFromGoal(depth, map, &recordCount, &recordSize);
+	trackedFree(records, recordSize * sizeof(struct endgameRecord));
+
+	return map;
+}
+
+/**
+*Name: endgameMapEntry
+*Purpose: This function will, given a map from buildEndgameMap and a board key,
+	return the board's entry byte.
+*Parameters:
+*	map --map to look in
+	key --board to look for
+*Returns:
+	the entry byte of the board
+	NOTINENDGAME if the map does not hold it
+*Author: Andrew Gendreau
+**/
+int endgameMapEntry(struct hashList *map, boardKey key)
+{
+	unsigned int value;							//value stored with the key
+
+	value = findPositionValue(map, key);
+
+	if(value == NOPOSITIONVALUE)
+	{
+		return NOTINENDGAME;
+	}
+
+	return (int) value;
+}
+
+/**
+*Name: endgameMapPath
+*Purpose: This function will, given a map from buildEndgameMap and a board it
+	holds, add the moves from the board to the goal onto the end of path.
+*Parameters:
+*	map --map to look in
+	key --key of the board
+	blankIndex --1d index of the blank on it
+	path --path to add to
+*Returns:
+	the number of moves on the path
+	NOTINENDGAME if the map does not hold the board
+*Author: Andrew Gendreau
+**/
+int endgameMapPath(struct hashList *map, boardKey key, int blankIndex, struct movePath *path)
+{
+	return followBestMoves(NULL, map, key, blankIndex, path);
+}
+
+/**
+*Name: releaseEndgameTable
+*Purpose: This function will unmap the table if one is mapped.
+*Parameters:
+*	table --table to release
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void releaseEndgameTable(struct endgameTable *table)
+{
+	if(table->mapping != NULL)
+	{
+		munmap(table->mapping, table->mappingSize);
+		table->mapping = NULL;
+	}
+}
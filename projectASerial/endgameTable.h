@@ -0,0 +1,198 @@
+/*NAME: endgameTable.h
+DATE: Oct 17th 2026
+VERSION: 1.0
+FILENAME: endgameTable.h
+PURPOSE: This is a header for endgameTable.c
+AUTHOR: Andrew Gendreau
+*/
+
+#include <stddef.h>
+
+#ifndef BOARDKEY_H_
+#define BOARDKEY_H_
+#include "boardKey.h"
+#endif
+
+#ifndef HASH_H_
+#define HASH_H_
+#include "hashList.h"
+#endif
+
+#ifndef MOVEPATH_H_
+#define MOVEPATH_H_
+#include "movePath.h"
+#endif
+
+#define ENDGAMEMAGIC "15PEND\r\n"				//first 8 bytes of every endgame table file
+#define ENDGAMEMAGICSIZE 8
+#define ENDGAMEVERSION 1					//raised whenever the layout below changes
+#define ENDGAMEFILENAME "endgame.db"				//file written if no name is given
+#define MAXENDGAMEDEPTH 63					//largest distance an entry has room for
+#define DEFAULTENDGAMEDEPTH 18					//depth generated if none is given
+#define NOTINENDGAME -1						//returned for a board the table does not hold
+
+/*
+* Every entry keeps its distance from the goal and the direction code of the
+* move that takes it one step closer in one byte, ENDGAMEENTRY packs them and
+* ENDGAMEDISTANCE and ENDGAMEDIRECTION unpack them.
+*/
+#define ENDGAMEENTRY(distance, direction) ((unsigned char) (((distance) << 2) | (direction)))
+#define ENDGAMEDISTANCE(entry) ((entry) >> 2)
+#define ENDGAMEDIRECTION(entry) ((entry) & 3)
+
+/*
+	This is the header at the start of every endgame table file. It is followed
+	by entryCount board keys in increasing order, and after them one entry byte
+	for each key, in the same order.
+*/
+struct endgameFileHeader
+{
+	char magic[ENDGAMEMAGICSIZE];				//ENDGAMEMAGIC
+	unsigned int version;					//ENDGAMEVERSION
+	unsigned int depth;					//every board this many moves from the goal or fewer is held
+	unsigned long long goal;				//key of the goal the distances are to
+	unsigned long long entryCount;				//number of boards held
+	unsigned long long checksum;				//FNV-1a checksum of the keys and entries
+};
+
+/*
+	This is a struct for an endgame table mapped from its file. keys and entries
+	point into the mapping.
+*/
+struct endgameTable
+{
+	unsigned char *mapping;					//the whole file, NULL if no table is loaded
+	size_t mappingSize;					//size of the file
+	unsigned long long entryCount;				//number of boards held
+	int depth;						//depth it was generated to
+	const boardKey *keys;					//the boards, in increasing order
+	const unsigned char *entries;				//distance and best move of each board
+};
+
+/**
+*Name: generateEndgameTable
+*Purpose: This function will run a breadth first search back from the goal
+	to the given depth and write every board it reaches, with its distance
+	and the move that takes it one step closer, to the given file.
+*Parameters:
+*	depth --moves from the goal to search
+	fileName --file to write
+*Returns:
+	the number of boards written
+	-1 if the file could not be written
+*Author: Andrew Gendreau
+**/
+long long generateEndgameTable(int depth, char *fileName);
+
+/**
+*Name: mapEndgameTable
+*Purpose: This function will, given a table and a file name, map the file read
+	only and check its header and its size. If they are right the table is
+	pointed at it. The checksum is not worked out here, it would read every
+	page of the file on every start, verifyEndgameTable does that.
+*Parameters:
+*	table --table to fill in
+	fileName --file to map
+*Returns:
+	PATTERNFILEOK if it was mapped
+	one of the other PATTERNFILE codes if not, table->mapping is then NULL
+*Author: Andrew Gendreau
+**/
+int mapEndgameTable(struct endgameTable *table, char *fileName);
+
+/**
+*Name: verifyEndgameTable
+*Purpose: This function will, given a mapped table, work out the checksum of
+	its keys and entries and check it against the one in its header.
+*Parameters:
+*	table --table to check, it has to be mapped
+*Returns:
+	PATTERNFILEOK if the checksum matches
+	PATTERNFILECORRUPT if it does not
+*Author: Andrew Gendreau
+**/
+int verifyEndgameTable(struct endgameTable *table);
+
+/**
+*Name: endgameEntry
+*Purpose: This function will, given a table and a board key, find the board
+	with a binary search over the keys.
+*Parameters:
+*	table --table to look in
+	key --board to look for
+*Returns:
+	the entry byte of the board
+	NOTINENDGAME if the table does not hold it
+*Author: Andrew Gendreau
+**/
+int endgameEntry(struct endgameTable *table, boardKey key);
+
+/**
+*Name: endgamePath
+*Purpose: This function will, given a table and a board, fill path with the
+	moves to the goal by looking up each board on the way and making its best move.
+*Parameters:
+*	table --table to look in
+	board --1d array containing the game board
+	path --path to fill
+*Returns:
+	the number of moves on the path
+	NOTINENDGAME if the table does not hold the board
+*Author: Andrew Gendreau
+**/
+int endgamePath(struct endgameTable *table, int board[BOARDSIZE], struct movePath *path);
+
+/**
+*Name: buildEndgameMap
+*Purpose: This function will run the same search back from the goal as
+	generateEndgameTable, to the given depth, but keep the boards it reaches
+	in memory, in a hash map from each key to its entry byte, instead of
+	writing them out.
+*Parameters:
+*	depth --moves from the goal to search
+*Returns:
+	the map, to be freed with destroyHashList
+*Author: Andrew Gendreau
+**/
+struct hashList *buildEndgameMap(int depth);
+
+/**
+*Name: endgameMapEntry
+*Purpose: This function will, given a map from buildEndgameMap and a board key,
+	return the board's entry byte.
+*Parameters:
+*	map --map to look in
+	key --board to look for
+*Returns:
+	the entry byte of the board
+	NOTINENDGAME if the map does not hold it
+*Author: Andrew Gendreau
+**/
+int endgameMapEntry(struct hashList *map, boardKey key);
+
+/**
+*Name: endgameMapPath
+*Purpose: This function will, given a map from buildEndgameMap and a board it
+	holds, add the moves from the board to the goal onto the end of path.
+*Parameters:
+*	map --map to look in
+	key --key of the board
+	blankIndex --1d index of the blank on it
+	path --path to add to
+*Returns:
+	the number of moves on the path
+	NOTINENDGAME if the map does not hold the board
+*Author: Andrew Gendreau
+**/
+int endgameMapPath(struct hashList *map, boardKey key, int blankIndex, struct movePath *path);
+
+/**
+*Name: releaseEndgameTable
+*Purpose: This function will unmap the table if one is mapped.
+*Parameters:
+*	table --table to release
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void releaseEndgameTable(struct endgameTable *table);
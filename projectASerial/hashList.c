@@ -1,26 +1,26 @@
 /*NAME: hashList.c
 DATE: Oct 14th 2016
-VERSION: 2.0
-FILENAME: hashList.h
-PURPOSE: This module will be a bucket based hash
-	table for the game board. The hash table will consist
-	of a linked list of buckets, these buckets will be indexed
-	by the bucket size, so if our bucket size is 10, bucket 0
-	will contain values 0-9, bucket 1 values 10-19, etc.
-	Each bucket will have an array of size bucket size that 
-	corresponds to every value in that bucket.
-	The idea will work like this:
-	We'll compute a hash value for the current game board,
+VERSION: 3.1
+FILENAME: hashList.c
+PURPOSE: This module will be the hash table of board positions we have
+	already seen. It is a flat open addressing table of board keys:
+	The hash value of a board is its boardKey (see boardKey.c),
 	if that value is WINNINGHASH (defined in hashList.h),
-	we know we've won due to the design of the hash function. 
-	If it is not that, we will mark that board as 
-	having been seen before using the following heuristic:
-	Check the buckets of the hash table to see which bucket it will
-	go to, then either create that bucket if we have not seen it 
-	and mark the value in that bucket so we know we've seen it before.
-	Or, go to that bucket and check the needed spot to see if we've 
-	seen it, if we have, let the caller know, if not, mark that value,
-	then tell the caller.
+	we know we've won due to the design of the key.
+	If it is not that, we will mark that board as having been seen
+	before using the following heuristic:
+	Mix the bits of the hash value and mask them down to a slot index,
+	this is the home slot of that value. Walk forward from the home slot,
+	wrapping around at the end of the table, until we either find the value,
+	in which case we've seen it before and let the caller know, or we find
+	an empty slot, in which case we store the value there and tell the caller
+	it is new. The table is never allowed to get more than 7/10 full, once it
+	would, the slot array is doubled and every value is placed again, so the
+	walk from the home slot stays short and a lookup is O(1) on average no matter
+	how many positions we have seen.
+	A table made with createHashMap also keeps a value beside every key, in a
+	second array with the same slots, so it can map a board to the index of its
+	node. The values move with their keys when the table grows.
 AUTHOR: Andrew Gendreau
 */
 
@@ -28,21 +28,20 @@ AUTHOR: Andrew Gendreau
 #include <stdlib.h>
 #include <string.h>
 
-#ifndef PATH_H_
-#define PATH_H_
-#include "pathfinder.h"
-#endif
-
-
 #include "hashList.h"
 
-struct hashList *head = NULL;							//head of the doubly linked list of buckets
+#ifndef MEMORY_H_
+#define MEMORY_H_
+#include "memoryTracker.h"
+#endif
+
+struct hashList *head = NULL;							//table of every position seen by the search
 
 /**
 *Name: createEmptyHashList
 *Purpose: This function will create a new hash table.
-	It will initalize the head pointer and initally set the
-	firstBucket pointer to null to signify it is empty.
+	It will initalize the head pointer to a table with
+	INITIALHASHCAPACITY empty slots.
 *Parameters: 
 	void
 *Returns:
@@ -51,279 +50,367 @@ struct hashList *head = NULL;							//head of the doubly linked list of buckets
 **/
 void createEmptyHashList()
 {
-	struct hashList *newHead;						//variable to hold the new head
-
-	newHead = malloc(sizeof(struct hashList));
-
-	newHead->firstBucket = NULL;
-
-	head = newHead;
+	head = createHashList(INITIALHASHCAPACITY);
 }
 
 /**
-*Name: InitalizeBucketArray
-*Purpose: This function will initalize a newly created bucket's
-	array to -1 to signify so far unseen values. It'll just run
-	through that bucket's array filling it with -1
+*Name: createHashList
+*Purpose: This function will, given a starting capacity, create an
+	empty hash table with at least that many slots. The capacity is
+	rounded up to a power of two so the home slot can be found with a mask.
 *Parameters: 
-*	BucketPointer --pointer to the bucket we need to fill
+*	initialCapacity --the number of slots wanted
 *Returns:
-	void
+	pointer to the new table
 *Author: Andrew Gendreau
 **/
-void InitalizeBucketArray(struct hashBucket *bucketPointer)
+struct hashList *createHashList(unsigned long initialCapacity)
 {
-	int i;									//loop control variable
+	struct hashList *newTable;						//table to be returned
+	unsigned long capacity;							//power of two capacity
 
+	capacity = 1;
 
-	for(i = 0; i < BUCKETSIZE; i++)
+	while(capacity < initialCapacity)
 	{
-		bucketPointer->bucketArray[i] = -1;
+		capacity = capacity * 2;
 	}
+
+	newTable = trackedMalloc(sizeof(struct hashList));
+
+	newTable->slots = trackedCalloc(capacity, sizeof(boardKey));	//calloc so every slot starts as EMPTYSLOT
+
+	newTable->values = NULL;
+	newTable->capacity = capacity;
+	newTable->count = 0;
+
+	return newTable;
 }
 
 /**
-*Name: createBucket
-*Purpose: This function will, given an ID for a bucket, and
-	the index of the value that caused this bucket's creation,
-	create said bucket and return it. It will also call a function
-	to initalize the array in the bucket.
+*Name: createHashMap
+*Purpose: This function will, given a starting capacity, create an empty
+	hash table that keeps a value with every key.
 *Parameters: 
-*	bucketID --ID for this bucket
-	valIndex --this is the index of the value that caused this bucket's creation
+*	initialCapacity --the number of slots wanted
 *Returns:
-	pointer to the created bucket.
+	pointer to the new table
 *Author: Andrew Gendreau
 **/
-struct hashBucket *createBucket(long int bucketID, long int valIndex)
-{
-	struct hashBucket *newBucket;						//pointer to the newly created bucket
-	
-	newBucket = malloc(sizeof(struct hashBucket));
-if(newBucket == NULL)
+struct hashList *createHashMap(unsigned long initialCapacity)
 {
-	printf("I ran out of hash bucket memory\n");
-}
-	newBucket->bucketID = bucketID;
-	newBucket->lastBucket = NULL;
-	newBucket->nextBucket = NULL;
-	InitalizeBucketArray(newBucket);
+	struct hashList *newTable;						//table to be returned
+
+	newTable = createHashList(initialCapacity);
+	newTable->values = trackedMalloc(newTable->capacity * sizeof(unsigned int));
 
-	newBucket->bucketArray[valIndex] = 1;
-	return newBucket;
+	return newTable;
 }
 
 /**
-*Name: insertBucket
-*Purpose: This function will, given a pointer to a hashbucket,
-	insert that bucket into the bucketList. It will have 2 cases to handle:
-	1: inserting into the ends of the list (will need to handle head and tail)
-	2: Inserting into the middle of the list
+*Name: homeSlot
+*Purpose: This function will, given a hash value and the capacity of a table,
+	find the slot the probe for that value starts at. The board hash values
+	are permutations of the same 16 nibbles, so they are scrambled with a
+	multiply and xor-shift finalizer before being masked down.
 *Parameters: 
-*	bucket --bucket to insert
+*	hashVal --hash value for a given board position.
+	capacity --number of slots in the table, a power of two
 *Returns:
+	index of the home slot
 *Author: Andrew Gendreau
 **/
-void insertBucket(struct hashBucket *bucket)
+unsigned long homeSlot(boardKey hashVal, unsigned long capacity)
 {
-	struct hashBucket *currentBucket;				//bucket we're working with now
-	struct hashBucket *rightNeighborTemp;				//pointer to the new bucket's right neighbor
+	unsigned long long mixed;						//scrambled form of the hash value
 
-	currentBucket = head->firstBucket;
+	mixed = hashVal;
+	mixed = mixed ^ (mixed >> 33);
+	mixed = mixed * 0xff51afd7ed558ccdULL;
+	mixed = mixed ^ (mixed >> 33);
 
-	if(currentBucket == NULL)					//if we're inserting into an empty list, version 1 of case 1
-	{								//in this case, we can just leave the neighbor pointers null
-		head->firstBucket = bucket;
+	return (unsigned long) (mixed & (capacity - 1));
+}
 
-		return;
-	}
-	else if(currentBucket->bucketID > bucket->bucketID)		//check if we're inserting at the head of a non-empty list
-	{
-		head->firstBucket = bucket;
+/**
+*Name: growHashList
+*Purpose: This function will double the number of slots in the given table.
+	It allocates the new slot array and places every stored value into it
+	again, since the home slots change with the capacity.
+*Parameters: 
+*	table --table to grow
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+static void growHashList(struct hashList *table)
+{
+	boardKey *oldSlots;							//slots we are moving out of
+	unsigned long oldCapacity;						//capacity before the grow
+	unsigned int *oldValues;						//values we are moving out of, NULL for a set
+	unsigned long i;							//loop control variable
+	unsigned long slot;							//slot we are placing a value in
 
-		currentBucket->lastBucket = bucket;
+	oldSlots = table->slots;
+	oldValues = table->values;
+	oldCapacity = table->capacity;
 
-		bucket->nextBucket = currentBucket;
+	table->capacity = oldCapacity * 2;
+	table->slots = trackedCalloc(table->capacity, sizeof(boardKey));
 
-		return;
+	if(oldValues != NULL)
+	{
+		table->values = trackedMalloc(table->capacity * sizeof(unsigned int));
 	}
-	else								//otherwise, we are dealing with either case 2
+
+	for(i = 0; i < oldCapacity; i++)
 	{
-		while(currentBucket != NULL)
+		if(oldSlots[i] != EMPTYSLOT)
 		{
-									//if we're inserting in the middle of the list
+			slot = homeSlot(oldSlots[i], table->capacity);
 
-			if(currentBucket->bucketID < bucket->bucketID && currentBucket->nextBucket != NULL)
+			while(table->slots[slot] != EMPTYSLOT)
 			{
-				rightNeighborTemp = currentBucket->nextBucket;
-
-									//check if we've found the spot to insert into
-
-				if(rightNeighborTemp->bucketID > bucket->bucketID)
-				{
-					currentBucket->nextBucket = bucket;
-
-					bucket->nextBucket = rightNeighborTemp;
-
-					rightNeighborTemp->lastBucket = bucket;
-
-					return;
-				}
+				slot = (slot + 1) & (table->capacity - 1);
 			}
-									//if we're inserting into the tail of the list
 
-			else if(currentBucket->bucketID < bucket->bucketID && currentBucket->nextBucket == NULL)
-			{
-				currentBucket->nextBucket = bucket;
+			table->slots[slot] = oldSlots[i];
 
-				return;
+			if(oldValues != NULL)
+			{
+				table->values[slot] = oldValues[i];
 			}
-		currentBucket = currentBucket->nextBucket;
 		}
 	}
+
+	trackedFree(oldSlots, oldCapacity * sizeof(boardKey));
+
+	if(oldValues != NULL)
+	{
+		trackedFree(oldValues, oldCapacity * sizeof(unsigned int));
+	}
 }
 
 /**
-*Name: findBucket
-*Purpose: This function will, given a hash value, compute the
-	bucket that value should be in. It will do this as follows:
-		hashVal/bucketSize
-	this will be integer division so the remainder will be truncated.
+*Name: insertPosition
+*Purpose: This function will, given a table and a hash value, probe the
+	table for that value. If it is there it will return 1, if it is not
+	it will store it in the first empty slot it found and return -1.
+	The table is grown before the insert if it is too full.
 *Parameters: 
-*	hashVal --hash value for a given board position.
+*	table --table to look in
+	hashVal --hash value for a given board position.
 *Returns:
-	ID of the bucket to insert into.
+	1 if given hash already existed
+	-1 if it did not.
 *Author: Andrew Gendreau
 **/
-long int findBucket(long int hashVal)
+int insertPosition(struct hashList *table, boardKey hashVal)
 {
-	long int whichBucket;					//variable to hold the bucket the hashvalue belongs in
+	unsigned long slot;							//slot we are probing
+	unsigned long mask;							//capacity - 1, for wrapping around
+
+	if((table->count + 1) * MAXLOADDENOMINATOR > table->capacity * MAXLOADNUMERATOR)
+	{
+		growHashList(table);
+	}
+
+	mask = table->capacity - 1;
+	slot = homeSlot(hashVal, table->capacity);
+
+	while(table->slots[slot] != EMPTYSLOT)
+	{
+		if(table->slots[slot] == hashVal)			//I have seen it before
+		{
+			return 1;
+		}
+		slot = (slot + 1) & mask;
+	}
 
-	whichBucket = hashVal / BUCKETSIZE;
+	table->slots[slot] = hashVal;					//mark it so that I know I have seen it now
+	table->count++;
 
-	return whichBucket;
+	return -1;
 }
 
 /**
-*Name: findIndex
-*Purpose: This function will, given a hash value, compute the
-	index that value will be inside in the bucket. It will do this as follows:
-		(hashVal mod bucketSize) - 1
-	this will return the index of the value in the bucket.
+*Name: containsPosition
+*Purpose: This function will, given a table and a hash value, probe the
+	table for that value without storing it.
 *Parameters: 
-*	hashVal --hash value for a given board position.
+*	table --table to look in
+	hashVal --hash value for a given board position.
 *Returns:
-	index of the hash value
+	1 if given hash is in the table
+	-1 if it is not.
 *Author: Andrew Gendreau
 **/
-long int findIndex(long int hashVal)
+int containsPosition(struct hashList *table, boardKey hashVal)
 {
-	long int bucketIndex;					//index of the element in the bucket
+	unsigned long slot;							//slot we are probing
+	unsigned long mask;							//capacity - 1, for wrapping around
+
+	mask = table->capacity - 1;
+	slot = homeSlot(hashVal, table->capacity);
 
-	bucketIndex = hashVal % BUCKETSIZE;
+	while(table->slots[slot] != EMPTYSLOT)
+	{
+		if(table->slots[slot] == hashVal)
+		{
+			return 1;
+		}
+		slot = (slot + 1) & mask;
+	}
 
-	return bucketIndex;
+	return -1;
 }
 
 /**
-*Name: haveISeenThisPosition
-*Purpose: This function will, given a hash value,
-	check the hash table for if that hash value exists in the
-	hash table already, if so, it will return 1 and change
-	the flag in that bucket for that index, if not,
-	return -1. We'll do this by traversing the list until
-	we find the target bucket and then check index i of that
-	bucket's array and return its value.
+*Name: insertPositionValue
+*Purpose: This function will, given a table made with createHashMap, a hash
+	value and a value, probe the table for the hash value. If it is there it
+	will return the value stored with it, if not it will store both.
+	The table is grown before the insert if it is too full.
 *Parameters: 
-*	hashVal --hash value for a given board position.
+*	table --table to look in
+	hashVal --hash value for a given board position.
+	value --value to store with it if it is new
 *Returns:
-	1 if given hash already existed
-	-1 if it did not.
+	the value already stored with the hash value
+	NOPOSITIONVALUE if it was not there and has been stored
 *Author: Andrew Gendreau
 **/
-int haveISeenThisPosition(long int hashVal)
+unsigned int insertPositionValue(struct hashList *table, boardKey hashVal, unsigned int value)
 {
-	struct hashBucket *currentBucket;			//bucket we're working with now
-	long int targetBucket;					//bucket of the target value
-	long int targetIndex;					//index of the target value
-
-	targetBucket = findBucket(hashVal);
-	targetIndex = findIndex(hashVal);
+	unsigned long slot;							//slot we are probing
+	unsigned long mask;							//capacity - 1, for wrapping around
 
-	if(head->firstBucket == NULL)				//check for the case where I'm the first hash value computed
+	if((table->count + 1) * MAXLOADDENOMINATOR > table->capacity * MAXLOADNUMERATOR)
 	{
-		currentBucket = createBucket(targetBucket, targetIndex);
-		insertBucket(currentBucket);
-		return -1;
+		growHashList(table);
 	}
 
-	currentBucket = head->firstBucket;
+	mask = table->capacity - 1;
+	slot = homeSlot(hashVal, table->capacity);
 
-	while(currentBucket->bucketID != targetBucket)
+	while(table->slots[slot] != EMPTYSLOT)
 	{
-		if(currentBucket->nextBucket == NULL && currentBucket->bucketID != targetBucket)
+		if(table->slots[slot] == hashVal)
 		{
-			currentBucket = NULL;
-			break;
+			return table->values[slot];
 		}
-		currentBucket = currentBucket->nextBucket;
+		slot = (slot + 1) & mask;
 	}
 
-	if(currentBucket == NULL)				//if that bucket did not exist
-	{
-			currentBucket = createBucket(targetBucket, targetIndex);
-			insertBucket(currentBucket);
-			return -1;
-	}
-	else
+	table->slots[slot] = hashVal;
+	table->values[slot] = value;
+	table->count++;
+
+	return NOPOSITIONVALUE;
+}
+
+/**
+*Name: findPositionValue
+*Purpose: This function will, given a table made with createHashMap and a
+	hash value, return the value stored with it without storing anything.
+*Parameters: 
+*	table --table to look in
+	hashVal --hash value for a given board position.
+*Returns:
+	the value stored with the hash value
+	NOPOSITIONVALUE if it is not in the table
+*Author: Andrew Gendreau
+**/
+unsigned int findPositionValue(struct hashList *table, boardKey hashVal)
+{
+	unsigned long slot;							//slot we are probing
+	unsigned long mask;							//capacity - 1, for wrapping around
+
+	mask = table->capacity - 1;
+	slot = homeSlot(hashVal, table->capacity);
+
+	while(table->slots[slot] != EMPTYSLOT)
 	{
-		if(currentBucket->bucketArray[targetIndex] == -1)	//if I haven't seen this value
+		if(table->slots[slot] == hashVal)
 		{
-			currentBucket->bucketArray[targetIndex] = 1;	//set its flag so that I know I have seen it now
-			return -1;
+			return table->values[slot];
 		}
-		else							//otherwise I have seen it before
+		slot = (slot + 1) & mask;
+	}
+
+	return NOPOSITIONVALUE;
+}
+
+/**
+*Name: replacePositionValue
+*Purpose: This function will, given a table made with createHashMap, a hash
+	value and a value, store the value with the hash value, in place of the
+	one stored with it before if it is already in the table.
+*Parameters: 
+*	table --table to store in
+	hashVal --hash value for a given board position.
+	value --value to keep with it
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void replacePositionValue(struct hashList *table, boardKey hashVal, unsigned int value)
+{
+	unsigned long slot;							//slot we are probing
+	unsigned long mask;							//capacity - 1, for wrapping around
+
+	mask = table->capacity - 1;
+	slot = homeSlot(hashVal, table->capacity);
+
+	while(table->slots[slot] != EMPTYSLOT)
+	{
+		if(table->slots[slot] == hashVal)
 		{
-			return 1;
+			table->values[slot] = value;
+			return;
 		}
+		slot = (slot + 1) & mask;
 	}
+
+	insertPositionValue(table, hashVal, value);
+}
+
+/**
+*Name: haveISeenThisPosition
+*Purpose: This function will, given a hash value,
+	check the hash table for if that hash value exists in the
+	hash table already, if so, it will return 1, if not, it will
+	store it and return -1.
+*Parameters: 
+*	hashVal --hash value for a given board position.
+*Returns:
+	1 if given hash already existed
+	-1 if it did not.
+*Author: Andrew Gendreau
+**/
+int haveISeenThisPosition(boardKey hashVal)
+{
+	return insertPosition(head, hashVal);
 }
 
 /**
-*Name: computeHashValue
-*Purpose: This function will, given a 1d array to
-	represent the board, compute the hash value representing that
-	board. The hash value will be as follows:
-		Compute a string of hexidecimal digits, each digit will
-		be the the hex digit for the number in that place. As an example,
-		the winning state as a hex string is:
-			123456780abcdef0
-		It will then make use of strtol to turn this string into a long
-		int representing that board state. This has the advantage of being assured to be
-		unique, as no two different board states will ever have the same hex string and thus,
-		never have the same hash value
+*Name: destroyHashList
+*Purpose: This function will free the slots of the given table, its values
+	if it has any, and the table itself.
 *Parameters: 
-*	board --array of ints of size BOARDSIZE to represent the board.
+*	table --table to free
 *Returns:
-	hash value of the board as a long int
+	void
 *Author: Andrew Gendreau
 **/
-long int computeHashValue(int board[BOARDSIZE])
+void destroyHashList(struct hashList *table)
 {
-	int i;							//loop control variable, will also represent the current board position
-	char hexBoard[BOARDSIZE];				//char array to hold the hex form of the current board
-	long int hashValue;					//long int to store the hash value
-	char *endPtr;						//character pointer for use in strtol
+	trackedFree(table->slots, table->capacity * sizeof(boardKey));
 
-	for(i = 0; i < BOARDSIZE; i++)				//for all 16 positions
+	if(table->values != NULL)
 	{
-		char hexChar[2]; 				//array of length 2 to hold this hex digit, length 2 to make it a string 		
-		sprintf(hexChar, "%x", board[i]);
-		hexBoard[i] = hexChar[0];
+		trackedFree(table->values, table->capacity * sizeof(unsigned int));
 	}
-	hexBoard[i] = '\0';
-
-	hashValue = strtol(hexBoard, &endPtr, 16);
 
-	return hashValue;
+	trackedFree(table, sizeof(struct hashList));
 }
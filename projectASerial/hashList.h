@@ -1,52 +1,60 @@
 /*NAME: hashList.h
 DATE: Oct 14th 2016
-VERSION: 2.0
+VERSION: 3.1
 FILENAME: hashList.h
 PURPOSE: This is the header file for hashList.c.
 AUTHOR: Andrew Gendreau
 */
 
-#define BUCKETSIZE 10						//bucket size for the hash table
-#define WINNINGHASH 1311768467463790320				//integer of the winning position
+#define WINNINGHASH 0x123456789abcdef0ULL			//key of the winning position
+#define INITIALHASHCAPACITY 1024				//starting number of slots, must be a power of two
+#define MAXLOADNUMERATOR 7					//the table doubles once it is more than 7/10 full
+#define MAXLOADDENOMINATOR 10
+#define EMPTYSLOT 0						//marker for an unused slot, no board ever hashes to 0
+#define NOPOSITIONVALUE 0xFFFFFFFFU				//returned by the map functions for a key that was not there
 
-#ifndef PATH_H_
-#define PATH_H_
-#include "pathfinder.h"
+#ifndef BOARDKEY_H_
+#define BOARDKEY_H_
+#include "boardKey.h"
 #endif
-/*
-* This struct will be a bucket in the hash table, it will hold an array 
-* of BUCKETSIZE, so this way, values can be represented as flags, for example,
-* value 25 will be in index 4 in bucket 2. the value in bucketArray[i] will be
-* -1 if the value has not been seen, and will be 1 if it has. It will also have pointers
-* to its neighbors, there will be no wraparound link.
-*/
-struct hashBucket					
-{
-	long int bucketArray[BUCKETSIZE];			//array to hold the flags for this bucket, the values will be either -1 or 1
-								//-1 will signify a value we have not seen and 1 represent one we have.
-	long int bucketID;					//ID for this bucket
-	struct hashBucket *lastBucket;				//pointer to the bucket behind this one.
-	struct hashBucket *nextBucket;				//pointer to the bucket in front of this one.
-};
 
 /*
-* This struct will contain a pointer to the head of the 
-* bucket list.
+* This struct is the visited position table. It is a flat open addressing
+* hash set, every slot holds the key of a board we have seen or EMPTYSLOT.
+* Collisions are resolved with linear probing, so a lookup walks forward from
+* the home slot of a key until it finds that key or an empty slot. The capacity is always a power of two so the home slot is found
+* with a mask, and the table doubles once it passes the maximum load factor.
+* A table made by createHashMap keeps a value for each key in the same slot of values.
 */
 struct hashList
 {
-	struct hashBucket *firstBucket;				//header of the bucket list
+	boardKey *slots;					//array of capacity slots holding board keys or EMPTYSLOT
+	unsigned int *values;					//value kept with the key in each slot, NULL for a set
+	unsigned long capacity;					//number of slots, always a power of two
+	unsigned long count;					//number of hash values stored in the table
 };
 
-//testing method, will probably erase this
-void traverseList();
+/**
+*Name: homeSlot
+*Purpose: This function will, given a hash value and the capacity of a table,
+	find the slot the probe for that value starts at. The board hash values
+	are permutations of the same 16 nibbles, so they are scrambled with a
+	multiply and xor-shift finalizer before being masked down.
+*Parameters: 
+*	hashVal --hash value for a given board position.
+	capacity --number of slots in the table, a power of two
+*Returns:
+	index of the home slot
+*Author: Andrew Gendreau
+**/
+unsigned long homeSlot(boardKey hashVal, unsigned long capacity);
 
 /**
 *Name: createEmptyHashList
 *Purpose: This function will create a new hash table.
-	It will initalize the head pointer and initally set the
-	firstBucket pointer to null to signify it is empty.
-*Parameters: 
+	It will initalize the head pointer to a table with
+	INITIALHASHCAPACITY empty slots.
+*Parameters:
 	void
 *Returns:
 	void
@@ -58,90 +66,126 @@ void createEmptyHashList();
 *Name: haveISeenThisPosition
 *Purpose: This function will, given a hash value,
 	check the hash table for if that hash value exists in the
-	hash table already, if so, it will return 1 and change
-	the flag in that bucket for that index, if not,
-	return -1. We'll do this by traversing the list until
-	we find the target bucket and then check index i of that
-	bucket's array and return its value.
-*Parameters: 
+	hash table already, if so, it will return 1, if not, it will
+	store it and return -1.
+*Parameters:
 *	hashVal --hash value for a given board position.
 *Returns:
 	1 if given hash already existed
 	-1 if it did not.
 *Author: Andrew Gendreau
 **/
-int haveISeenThisPosition(long int hashVal);
+int haveISeenThisPosition(boardKey hashVal);
 
 /**
-*Name: createBucket
-*Purpose: This function will, given an ID for a bucket, and
-	the index of the value that caused this bucket's creation,
-	create said bucket and return it. It will also call a function
-	to initalize the array in the bucket.
-*Parameters: 
-*	bucketID --ID for this bucket
-	valIndex --this is the index of the value that caused this bucket's creation
+*Name: createHashList
+*Purpose: This function will, given a starting capacity, create an
+	empty hash table with at least that many slots. The capacity is
+	rounded up to a power of two.
+*Parameters:
+*	initialCapacity --the number of slots wanted
 *Returns:
-	pointer to the created bucket.
+	pointer to the new table
 *Author: Andrew Gendreau
 **/
-struct hashBucket *createBucket(long int bucketID, long int valIndex);
+struct hashList *createHashList(unsigned long initialCapacity);
 
 /**
-*Name: insertBucket
-*Purpose: This function will, given a pointer to a hashbucket,
-	insert that bucket into the bucketList. It will have 2 cases to handle:
-	1: inserting into the ends of the list (will need to handle head and tail)
-	2: Inserting into the middle of the list
+*Name: createHashMap
+*Purpose: This function will, given a starting capacity, create an empty
+	hash table that keeps a value with every key.
 *Parameters: 
-*	bucket --bucket to insert
+*	initialCapacity --the number of slots wanted
 *Returns:
+	pointer to the new table
 *Author: Andrew Gendreau
 **/
-void insertBucket(struct hashBucket *BucketPointer);
+struct hashList *createHashMap(unsigned long initialCapacity);
 
 /**
-*Name: haveISeenThisPosition
-*Purpose: This function will, given a hash value,
-	check the hash table for if that hash value exists in the
-	hash table already, if so, it will return 1 and change
-	the flag in that bucket for that index, if not,
-	return -1. We'll do this by traversing the list until
-	we find the target bucket and then check index i of that
-	bucket's array and return its value.
-*Parameters: 
-*	hashVal --hash value for a given board position.
+*Name: insertPosition
+*Purpose: This function will, given a table and a hash value, probe the
+	table for that value. If it is there it will return 1, if it is not
+	it will store it in the first empty slot it found and return -1.
+	The table is grown before the insert if it is too full.
+*Parameters:
+*	table --table to look in
+	hashVal --hash value for a given board position.
 *Returns:
 	1 if given hash already existed
 	-1 if it did not.
 *Author: Andrew Gendreau
 **/
-long int computeHashValue(int board[BOARDSIZE]);
+int insertPosition(struct hashList *table, boardKey hashVal);
 
 /**
-*Name: findBucket
-*Purpose: This function will, given a hash value, compute the
-	bucket that value should be in. It will do this as follows:
-		hashVal/bucketSize
-	this will be integer division so the remainder will be truncated.
+*Name: containsPosition
+*Purpose: This function will, given a table and a hash value, probe the
+	table for that value without storing it.
 *Parameters: 
-*	hashVal --hash value for a given board position.
+*	table --table to look in
+	hashVal --hash value for a given board position.
 *Returns:
-	ID of the bucket to insert into.
+	1 if given hash is in the table
+	-1 if it is not.
 *Author: Andrew Gendreau
 **/
-long int findBucket(long int hashVal);
+int containsPosition(struct hashList *table, boardKey hashVal);
 
 /**
-*Name: findIndex
-*Purpose: This function will, given a hash value, compute the
-	index that value will be inside in the bucket. It will do this as follows:
-		(hashVal mod bucketSize) - 1
-	this will return the index of the value in the bucket.
+*Name: insertPositionValue
+*Purpose: This function will, given a table made with createHashMap, a hash
+	value and a value, probe the table for the hash value. If it is there it
+	will return the value stored with it, if not it will store both.
+	The table is grown before the insert if it is too full.
 *Parameters: 
-*	hashVal --hash value for a given board position.
+*	table --table to look in
+	hashVal --hash value for a given board position.
+	value --value to store with it if it is new
 *Returns:
-	index of the hash value
+	the value already stored with the hash value
+	NOPOSITIONVALUE if it was not there and has been stored
+*Author: Andrew Gendreau
+**/
+unsigned int insertPositionValue(struct hashList *table, boardKey hashVal, unsigned int value);
+
+/**
+*Name: findPositionValue
+*Purpose: This function will, given a table made with createHashMap and a
+	hash value, return the value stored with it without storing anything.
+*Parameters: 
+*	table --table to look in
+	hashVal --hash value for a given board position.
+*Returns:
+	the value stored with the hash value
+	NOPOSITIONVALUE if it is not in the table
+*Author: Andrew Gendreau
+**/
+unsigned int findPositionValue(struct hashList *table, boardKey hashVal);
+
+/**
+*Name: replacePositionValue
+*Purpose: This function will, given a table made with createHashMap, a hash
+	value and a value, store the value with the hash value, in place of the
+	one stored with it before if it is already in the table.
+*Parameters: 
+*	table --table to store in
+	hashVal --hash value for a given board position.
+	value --value to keep with it
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void replacePositionValue(struct hashList *table, boardKey hashVal, unsigned int value);
+
+/**
+*Name: destroyHashList
+*Purpose: This function will free the slots of the given table, its values
+	if it has any, and the table itself.
+*Parameters:
+*	table --table to free
+*Returns:
+	void
 *Author: Andrew Gendreau
 **/
-long int findIndex(long int hashVal);
+void destroyHashList(struct hashList *table);
@@ -0,0 +1,1028 @@
+/*NAME: heuristic.c
+DATE: Oct 17th 2026
+VERSION: 1.0
+FILENAME: heuristic.c
+PURPOSE: This module will hold the lower bounds the informed engines use, each one
+	an estimate of the moves left that is never too high. There are three:
+		manhattan --the sum of how far each tile is from home, in rows and columns.
+		conflict --the Manhattan distance plus linear conflicts. Two tiles in their
+			home row (or column) but in the wrong order have to pass each other,
+			so one of them has to step out of the line and back, two more moves.
+			For each line the fewest tiles that have to step out is the number of
+			its tiles that belong in it less the longest run of them already in
+			order, which is looked up in a table of every line.
+		walking --the walking distance. Looking only at which row each tile belongs
+			in, the board is a 4x4 table of how many tiles of each home row are in
+			each row, and a move swaps the blank with one tile from the row above or
+			below. A breadth first search over those tables from the goal gives the
+			fewest moves to get every tile into its home row, the same is true of
+			columns, and the two are added together.
+		pdb555, pdb663 --the additive pattern databases of patternDatabase.c, the
+			sum of the table entries of every group of the partition. The tables
+			are mapped from pdb555.db or pdb663.db if they have been generated.
+		pdb555r, pdb663r --the same tables looked up on the board and on the board
+			reflected about its main diagonal, taking the larger. The goal is its own
+			reflection once tiles are relabelled, so the reflected board needs as many
+			moves as the board, and the second value costs no extra memory.
+	Every heuristic keeps the parts it was added up from, so a child's value comes
+	from its parent's and the one tile that moved, nothing is recomputed for the
+	whole board. The Manhattan distance changes by that tile's change, linear conflict
+	only has to look at the two lines the tile left and entered, and the walking
+	distance moves to a neighbouring table through a transition table. A pattern
+	database only has to rank again the group of the tile that moved.
+AUTHOR: Andrew Gendreau
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef HEURISTIC_H_
+#define HEURISTIC_H_
+#include "heuristic.h"
+#endif
+
+#ifndef HASH_H_
+#define HASH_H_
+#include "hashList.h"
+#endif
+
+#ifndef MEMORY_H_
+#define MEMORY_H_
+#include "memoryTracker.h"
+#endif
+
+/*
+	This is a struct for one walking distance table, packed into a key, and
+	the fewest moves it is from the goal table.
+*/
+struct walkingState
+{
+	unsigned long long key;							//the packed table and the blank's line
+	int distance;								//moves from the goal table
+};
+
+int manhattanTable[BOARDSIZE][BOARDSIZE];					//distance of tile t at index i from its home
+int manhattanReady = 0;								//1 once manhattanTable is filled in
+unsigned char lineConflictTable[LINECODES];					//tiles that have to step out of a line, by line code
+int conflictReady = 0;								//1 once lineConflictTable is filled in
+struct walkingState *walkingStates = NULL;					//every walking distance table, sorted by key
+int walkingStateCount = 0;							//number of entries in walkingStates
+int (*walkingNext)[WALKINGSIDES][BOARDHEIGHT] = NULL;				//state reached by moving a tile of a home line in
+int walkingReady = 0;								//1 once the walking distance tables are built
+struct partition *pattern555 = NULL;						//the 555 partition once its tables are built
+struct partition *pattern663 = NULL;						//the 663 partition once its tables are built
+
+/**
+*Name: prepareManhattan
+*Purpose: This function will fill manhattanTable with the distance of
+	every tile at every index from its home, tile t belongs at index t - 1.
+	The blank's row is all 0, it is not counted.
+*Parameters:
+	void
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+static void prepareManhattan()
+{
+	int tile;								//tile we are filling in
+	int index;								//1d index it is at
+
+	if(manhattanReady == 1)
+	{
+		return;
+	}
+
+	for(tile = 0; tile < BOARDSIZE; tile++)
+	{
+		for(index = 0; index < BOARDSIZE; index++)
+		{
+			if(tile == 0)
+			{
+				manhattanTable[tile][index] = 0;
+			}
+			else
+			{
+				manhattanTable[tile][index] = abs(findX(index) - findX(tile - 1)) + abs(findY(index) - findY(tile - 1));
+			}
+		}
+	}
+
+	manhattanReady = 1;
+}
+
+/**
+*Name: manhattanDistance
+*Purpose: This function will, given a board, add up how many rows and columns
+	every tile is away from where it belongs. No tile can get home in fewer
+	moves than that, so it never overestimates the moves left.
+*Parameters:
+*	board --1d array containing the game board
+*Returns:
+	the sum of the distances of the tiles, the blank not counted
+*Author: Andrew Gendreau
+**/
+int manhattanDistance(int board[BOARDSIZE])
+{
+	int i;									//loop control variable
+	int distance;								//sum so far
+
+	prepareManhattan();
+
+	distance = 0;
+
+	for(i = 0; i < BOARDSIZE; i++)
+	{
+		distance += manhattanTable[board[i]][i];
+	}
+
+	return distance;
+}
+
+/**
+*Name: evaluateManhattan
+*Purpose: This function will, given a board, fill in its state with its
+	Manhattan distance.
+*Parameters:
+*	board --1d array containing the game board
+	state --state to fill in
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+static void evaluateManhattan(int board[BOARDSIZE], struct heuristicState *state)
+{
+	state->manhattan = manhattanDistance(board);
+	state->value = state->manhattan;
+}
+
+/**
+*Name: updateManhattan
+*Purpose: This function will work out a child's Manhattan distance from its
+	parent's, only the tile that moved has changed its distance.
+*Parameters:
+*	parent --state of the parent board
+	child --state to fill in
+	board --the child board
+	tile --tile that moved
+	fromIndex --index it moved from
+	toIndex --index it moved to
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+static void updateManhattan(struct heuristicState *parent, struct heuristicState *child, int board[BOARDSIZE],
+	int tile, int fromIndex, int toIndex)
+{
+	child->manhattan = parent->manhattan - manhattanTable[tile][fromIndex] + manhattanTable[tile][toIndex];
+	child->value = child->manhattan;
+}
+
+/**
+*Name: prepareConflict
+*Purpose: This function will fill lineConflictTable. A line code has one
+	base 5 digit for each cell of the line, in order, the home position in
+	the line of the tile there, or NOTINLINE if it belongs in another line.
+	The entry is the number of tiles that belong in the line less the longest
+	run of them whose home positions are in increasing order.
+*Parameters:
+	void
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+static void prepareConflict()
+{
+	int code;								//line code we are filling in
+	int digits[BOARDWIDTH];							//home positions in the line, by cell
+	int longestEndingAt[BOARDWIDTH];					//longest increasing run ending at each cell
+	int tilesInLine;							//tiles that belong in the line
+	int longestRun;								//longest increasing run in the line
+	int remaining;								//code left to split into digits
+	int i;									//loop control variable
+	int j;									//another loop control variable
+
+	prepareManhattan();
+
+	if(conflictReady == 1)
+	{
+		return;
+	}
+
+	for(code = 0; code < LINECODES; code++)
+	{
+		remaining = code;
+		tilesInLine = 0;
+		longestRun = 0;
+
+		for(i = 0; i < BOARDWIDTH; i++)
+		{
+			digits[i] = remaining % (NOTINLINE + 1);
+			remaining = remaining / (NOTINLINE + 1);
+			longestEndingAt[i] = 0;
+
+			if(digits[i] == NOTINLINE)
+			{
+				continue;
+			}
+
+			tilesInLine++;
+			longestEndingAt[i] = 1;
+
+			for(j = 0; j < i; j++)
+			{
+				if(digits[j] != NOTINLINE && digits[j] < digits[i] && longestEndingAt[j] + 1 > longestEndingAt[i])
+				{
+					longestEndingAt[i] = longestEndingAt[j] + 1;
+				}
+			}
+
+			if(longestEndingAt[i] > longestRun)
+			{
+				longestRun = longestEndingAt[i];
+			}
+		}
+
+		lineConflictTable[code] = (unsigned char) (tilesInLine - longestRun);
+	}
+
+	conflictReady = 1;
+}
+
+/**
+*Name: lineConflicts
+*Purpose: This function will, given a board and a line, work out its line
+	code and look up how many tiles have to step out of it. Lines 0 to 3 are
+	the rows and lines 4 to 7 the columns.
+*Parameters:
+*	board --1d array containing the game board
+	line --line to look at
+*Returns:
+	the number of tiles that have to step out of the line
+*Author: Andrew Gendreau
+**/
+static int lineConflicts(int board[BOARDSIZE], int line)
+{
+	int code;								//line code of the line
+	int place;								//value of the current digit
+	int cell;								//cell of the line we are at
+	int tile;								//tile in that cell
+	int home;								//home position of that tile in the line
+
+	code = 0;
+	place = 1;
+
+	for(cell = 0; cell < BOARDWIDTH; cell++)
+	{
+		home = NOTINLINE;
+
+		if(line < BOARDHEIGHT)
+		{
+			tile = board[line * BOARDWIDTH + cell];
+
+			if(tile != 0 && findY(tile - 1) == line)
+			{
+				home = findX(tile - 1);
+			}
+		}
+		else
+		{
+			tile = board[cell * BOARDWIDTH + (line - BOARDHEIGHT)];
+
+			if(tile != 0 && findX(tile - 1) == line - BOARDHEIGHT)
+			{
+				home = findY(tile - 1);
+			}
+		}
+
+		code += home * place;
+		place = place * (NOTINLINE + 1);
+	}
+
+	return lineConflictTable[code];
+}
+
+/**
+*Name: evaluateConflict
+*Purpose: This function will, given a board, fill in its state with its
+	Manhattan distance, the conflicts of every line and their sum. The value
+	is the Manhattan distance plus two moves for every tile that has to step
+	out of a line.
+*Parameters:
+*	board --1d array containing the game board
+	state --state to fill in
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+static void evaluateConflict(int board[BOARDSIZE], struct heuristicState *state)
+{
+	int line;								//line we are looking at
+
+	state->manhattan = manhattanDistance(board);
+	state->conflictTotal = 0;
+
+	for(line = 0; line < LINECOUNT; line++)
+	{
+		state->lineConflicts[line] = (unsigned char) lineConflicts(board, line);
+		state->conflictTotal += state->lineConflicts[line];
+	}
+
+	state->value = state->manhattan + 2 * state->conflictTotal;
+}
+
+/**
+*Name: updateConflict
+*Purpose: This function will work out a child's linear conflict from its
+	parent's. A tile moving along a row keeps the order of that row, so only
+	the two columns it left and entered can change, and a tile moving along
+	a column only changes the two rows.
+*Parameters:
+*	parent --state of the parent board
+	child --state to fill in
+	board --the child board
+	tile --tile that moved
+	fromIndex --index it moved from
+	toIndex --index it moved to
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+static void updateConflict(struct heuristicState *parent, struct heuristicState *child, int board[BOARDSIZE],
+	int tile, int fromIndex, int toIndex)
+{
+	int leftLine;								//line the tile left
+	int enteredLine;							//line the tile entered
+
+	if(findY(fromIndex) == findY(toIndex))
+	{
+		leftLine = BOARDHEIGHT + findX(fromIndex);
+		enteredLine = BOARDHEIGHT + findX(toIndex);
+	}
+	else
+	{
+		leftLine = findY(fromIndex);
+		enteredLine = findY(toIndex);
+	}
+
+	memcpy(child->lineConflicts, parent->lineConflicts, sizeof(child->lineConflicts));
+
+	child->lineConflicts[leftLine] = (unsigned char) lineConflicts(board, leftLine);
+	child->lineConflicts[enteredLine] = (unsigned char) lineConflicts(board, enteredLine);
+
+	child->conflictTotal = parent->conflictTotal
+		- parent->lineConflicts[leftLine] - parent->lineConflicts[enteredLine]
+		+ child->lineConflicts[leftLine] + child->lineConflicts[enteredLine];
+
+	child->manhattan = parent->manhattan - manhattanTable[tile][fromIndex] + manhattanTable[tile][toIndex];
+	child->value = child->manhattan + 2 * child->conflictTotal;
+}
+
+/**
+*Name: packWalking
+*Purpose: This function will, given a walking distance table and the line
+	the blank is in, pack them into a key, two bits for the blank's line
+	and three bits for each count.
+*Parameters:
+*	counts --counts[i][j] is the number of tiles in line i that belong in line j
+	blankLine --line the blank is in
+*Returns:
+	the key
+*Author: Andrew Gendreau
+**/
+static unsigned long long packWalking(int counts[BOARDHEIGHT][BOARDHEIGHT], int blankLine)
+{
+	unsigned long long key;							//key being built
+	int i;									//loop control variable
+	int j;									//another loop control variable
+
+	key = (unsigned long long) blankLine;
+
+	for(i = 0; i < BOARDHEIGHT; i++)
+	{
+		for(j = 0; j < BOARDHEIGHT; j++)
+		{
+			key |= (unsigned long long) counts[i][j] << (2 + 3 * (i * BOARDHEIGHT + j));
+		}
+	}
+
+	return key;
+}
+
+/**
+*Name: unpackWalking
+*Purpose: This function will, given a key, unpack the walking distance
+	table and the blank's line from it.
+*Parameters:
+*	key --key to unpack
+	counts --table to fill
+*Returns:
+	the line the blank is in
+*Author: Andrew Gendreau
+**/
+static int unpackWalking(unsigned long long key, int counts[BOARDHEIGHT][BOARDHEIGHT])
+{
+	int i;									//loop control variable
+	int j;									//another loop control variable
+
+	for(i = 0; i < BOARDHEIGHT; i++)
+	{
+		for(j = 0; j < BOARDHEIGHT; j++)
+		{
+			counts[i][j] = (int) ((key >> (2 + 3 * (i * BOARDHEIGHT + j))) & 7);
+		}
+	}
+
+	return (int) (key & 3);
+}
+
+/**
+*Name: compareWalking
+*Purpose: This function will compare two walking distance states by key, for qsort and bsearch.
+*Parameters:
+*	first --first state
+	second --second state
+*Returns:
+	-1, 0 or 1 as the first key is less than, equal to or more than the second
+*Author: Andrew Gendreau
+**/
+static int compareWalking(const void *first, const void *second)
+{
+	unsigned long long firstKey;						//key of the first state
+	unsigned long long secondKey;						//key of the second state
+
+	firstKey = ((const struct walkingState *) first)->key;
+	secondKey = ((const struct walkingState *) second)->key;
+
+	if(firstKey < secondKey)
+	{
+		return -1;
+	}
+	else if(firstKey > secondKey)
+	{
+		return 1;
+	}
+	return 0;
+}
+
+/**
+*Name: findWalkingIndex
+*Purpose: This function will, given a key, find the index of its state in walkingStates.
+*Parameters:
+*	key --key to look for
+*Returns:
+	the index of the state
+	NOWALKINGSTATE if there is none
+*Author: Andrew Gendreau
+**/
+static int findWalkingIndex(unsigned long long key)
+{
+	struct walkingState wanted;						//state to look for
+	struct walkingState *found;						//state found
+
+	wanted.key = key;
+	found = bsearch(&wanted, walkingStates, walkingStateCount, sizeof(struct walkingState), compareWalking);
+
+	if(found == NULL)
+	{
+		return NOWALKINGSTATE;
+	}
+	return (int) (found - walkingStates);
+}
+
+/**
+*Name: prepareWalking
+*Purpose: This function will build the walking distance tables. It runs a
+	breadth first search from the goal table, where line i holds the tiles
+	of line i and the blank is in the last line, keeping every table in the
+	order it was found, so walkingStates doubles as the queue. The tables are
+	then sorted by key and the transitions from each of them worked out.
+	Rows and columns give the same tables, so the one set serves both.
+*Parameters:
+	void
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+static void prepareWalking()
+{
+	struct hashList *seen;							//keys of the tables found so far
+	int counts[BOARDHEIGHT][BOARDHEIGHT];					//table we are expanding
+	int capacity;								//entries walkingStates has room for
+	int expanding;							//next table to expand
+	int blankLine;								//line the blank is in
+	int nextLine;								//line a tile comes from
+	int side;								//above or below the blank
+	int group;								//home line of the tile that moves
+	int i;									//loop control variable
+	unsigned long long key;							//key of a table
+
+	if(walkingReady == 1)
+	{
+		return;
+	}
+
+	capacity = INITIALHASHCAPACITY;
+	walkingStates = trackedMalloc(capacity * sizeof(struct walkingState));
+	seen = createHashList(INITIALHASHCAPACITY);
+
+	memset(counts, 0, sizeof(counts));
+
+	for(i = 0; i < BOARDHEIGHT; i++)
+	{
+		counts[i][i] = BOARDWIDTH;
+	}
+	counts[BOARDHEIGHT - 1][BOARDHEIGHT - 1] = BOARDWIDTH - 1;		//the blank belongs in the last line
+
+	walkingStates[0].key = packWalking(counts, BOARDHEIGHT - 1);
+	walkingStates[0].distance = 0;
+	walkingStateCount = 1;
+	insertPosition(seen, walkingStates[0].key);
+
+	for(expanding = 0; expanding < walkingStateCount; expanding++)
+	{
+		blankLine = unpackWalking(walkingStates[expanding].key, counts);
+
+		for(side = 0; side < WALKINGSIDES; side++)
+		{
+			nextLine = (side == WALKINGFROMABOVE) ? blankLine - 1 : blankLine + 1;
+
+			if(nextLine < 0 || nextLine >= BOARDHEIGHT)
+			{
+				continue;
+			}
+
+			for(group = 0; group < BOARDHEIGHT; group++)
+			{
+				if(counts[nextLine][group] == 0)
+				{
+					continue;
+				}
+
+				counts[nextLine][group]--;
+				counts[blankLine][group]++;
+				key = packWalking(counts, nextLine);
+				counts[nextLine][group]++;
+				counts[blankLine][group]--;
+
+				if(insertPosition(seen, key) < 0)
+				{
+					if(walkingStateCount == capacity)
+					{
+						walkingStates = trackedRealloc(walkingStates, capacity * sizeof(struct walkingState),
+							capacity * 2 * sizeof(struct walkingState));
+						capacity = capacity * 2;
+					}
+
+					walkingStates[walkingStateCount].key = key;
+					walkingStates[walkingStateCount].distance = walkingStates[expanding].distance + 1;
+					walkingStateCount++;
+				}
+			}
+		}
+	}
+
+	destroyHashList(seen);
+
+	qsort(walkingStates, walkingStateCount, sizeof(struct walkingState), compareWalking);
+
+	walkingNext = trackedMalloc(walkingStateCount * sizeof(*walkingNext));
+
+	for(i = 0; i < walkingStateCount; i++)
+	{
+		blankLine = unpackWalking(walkingStates[i].key, counts);
+
+		for(side = 0; side < WALKINGSIDES; side++)
+		{
+			nextLine = (side == WALKINGFROMABOVE) ? blankLine - 1 : blankLine + 1;
+
+			for(group = 0; group < BOARDHEIGHT; group++)
+			{
+				walkingNext[i][side][group] = NOWALKINGSTATE;
+
+				if(nextLine < 0 || nextLine >= BOARDHEIGHT || counts[nextLine][group] == 0)
+				{
+					continue;
+				}
+
+				counts[nextLine][group]--;
+				counts[blankLine][group]++;
+				walkingNext[i][side][group] = findWalkingIndex(packWalking(counts, nextLine));
+				counts[nextLine][group]++;
+				counts[blankLine][group]--;
+			}
+		}
+	}
+
+	walkingReady = 1;
+}
+
+/**
+*Name: evaluateWalking
+*Purpose: This function will, given a board, build its walking distance
+	tables for the rows and the columns, find them and fill in its state
+	with their indexes and the sum of their distances.
+*Parameters:
+*	board --1d array containing the game board
+	state --state to fill in
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+static void evaluateWalking(int board[BOARDSIZE], struct heuristicState *state)
+{
+	int rowCounts[BOARDHEIGHT][BOARDHEIGHT];				//tiles in each row by home row
+	int columnCounts[BOARDHEIGHT][BOARDHEIGHT];				//tiles in each column by home column
+	int blankIndex;								//index of the blank
+	int i;									//loop control variable
+
+	memset(rowCounts, 0, sizeof(rowCounts));
+	memset(columnCounts, 0, sizeof(columnCounts));
+	blankIndex = 0;
+
+	for(i = 0; i < BOARDSIZE; i++)
+	{
+		if(board[i] == 0)
+		{
+			blankIndex = i;
+		}
+		else
+		{
+			rowCounts[findY(i)][findY(board[i] - 1)]++;
+			columnCounts[findX(i)][findX(board[i] - 1)]++;
+		}
+	}
+
+	state->walkingRows = findWalkingIndex(packWalking(rowCounts, findY(blankIndex)));
+	state->walkingColumns = findWalkingIndex(packWalking(columnCounts, findX(blankIndex)));
+	state->value = walkingStates[state->walkingRows].distance + walkingStates[state->walkingColumns].distance;
+}
+
+/**
+*Name: updateWalking
+*Purpose: This function will work out a child's walking distance from its
+	parent's. A tile moving along a column changes only the row table and
+	one moving along a row only the column table, and the new table is the
+	parent's table's transition for the side the tile came from and its home line.
+*Parameters:
+*	parent --state of the parent board
+	child --state to fill in
+	board --the child board
+	tile --tile that moved
+	fromIndex --index it moved from
+	toIndex --index it moved to
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+static void updateWalking(struct heuristicState *parent, struct heuristicState *child, int board[BOARDSIZE],
+	int tile, int fromIndex, int toIndex)
+{
+	int side;								//side of the blank the tile came from
+
+	child->walkingRows = parent->walkingRows;
+	child->walkingColumns = parent->walkingColumns;
+
+	if(findY(fromIndex) != findY(toIndex))
+	{
+		side = (findY(fromIndex) < findY(toIndex)) ? WALKINGFROMABOVE : WALKINGFROMBELOW;
+		child->walkingRows = walkingNext[parent->walkingRows][side][findY(tile - 1)];
+	}
+	else
+	{
+		side = (findX(fromIndex) < findX(toIndex)) ? WALKINGFROMABOVE : WALKINGFROMBELOW;
+		child->walkingColumns = walkingNext[parent->walkingColumns][side][findX(tile - 1)];
+	}
+
+	child->value = walkingStates[child->walkingRows].distance + walkingStates[child->walkingColumns].distance;
+}
+
+/**
+*Name: evaluatePattern
+*Purpose: This function will, given a partition and a board, fill in the
+	board's state with the rank of every group and the sum of their entries.
+	With reflect it will do the same for the board reflected about the main
+	diagonal, and the value is the larger of the two sums.
+*Parameters:
+*	partition --partition to look the board up in
+	reflect --1 to also look up the reflected board
+	board --1d array containing the game board
+	state --state to fill in
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+static void evaluatePattern(struct partition *partition, int reflect, int board[BOARDSIZE], struct heuristicState *state)
+{
+	int where[BOARDSIZE];							//1d index of every tile
+	int g;									//group we are looking up
+	int i;									//loop control variable
+
+	for(i = 0; i < BOARDSIZE; i++)
+	{
+		where[board[i]] = i;
+	}
+
+	state->patternSum = 0;
+	state->reflectedSum = 0;
+
+	for(g = 0; g < partition->groupCount; g++)
+	{
+		state->patternRanks[g] = groupRank(&partition->groups[g], where);
+		state->patternSum += partition->groups[g].distances[state->patternRanks[g]];
+
+		if(reflect == 1)
+		{
+			state->reflectedRanks[g] = reflectedGroupRank(&partition->groups[g], where);
+			state->reflectedSum += partition->groups[g].distances[state->reflectedRanks[g]];
+		}
+	}
+
+	state->value = (state->reflectedSum > state->patternSum) ? state->reflectedSum : state->patternSum;
+}
+
+/**
+*Name: updatePattern
+*Purpose: This function will work out a child's pattern database value from
+	its parent's. Only the group of the tile that moved has a new rank, so its
+	entry is swapped for the new one and the rest are kept. On the reflected
+	board the tile that moved is its reflection, so it is that tile's group
+	that changes there.
+*Parameters:
+*	partition --partition to look the board up in
+	reflect --1 to also look up the reflected board
+	parent --state of the parent board
+	child --state to fill in
+	board --the child board
+	tile --tile that moved
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+static void updatePattern(struct partition *partition, int reflect, struct heuristicState *parent,
+	struct heuristicState *child, int board[BOARDSIZE], int tile)
+{
+	struct patternGroup *group;						//group of the tile that moved
+	int where[BOARDSIZE];							//1d index of every tile
+	int g;									//index of that group
+	int i;									//loop control variable
+
+	for(i = 0; i < BOARDSIZE; i++)
+	{
+		where[board[i]] = i;
+	}
+
+	g = partition->groupOfTile[tile];
+	group = &partition->groups[g];
+
+	memcpy(child->patternRanks, parent->patternRanks, sizeof(child->patternRanks));
+	child->patternRanks[g] = groupRank(group, where);
+	child->patternSum = parent->patternSum - group->distances[parent->patternRanks[g]]
+		+ group->distances[child->patternRanks[g]];
+	child->reflectedSum = 0;
+
+	if(reflect == 1)
+	{
+		g = partition->groupOfTile[reflectedTile[tile]];
+		group = &partition->groups[g];
+
+		memcpy(child->reflectedRanks, parent->reflectedRanks, sizeof(child->reflectedRanks));
+		child->reflectedRanks[g] = reflectedGroupRank(group, where);
+		child->reflectedSum = parent->reflectedSum - group->distances[parent->reflectedRanks[g]]
+			+ group->distances[child->reflectedRanks[g]];
+	}
+
+	child->value = (child->reflectedSum > child->patternSum) ? child->reflectedSum : child->patternSum;
+}
+
+/**
+*Name: preparePattern555
+*Purpose: This function will load the tables of the 555 partition, from
+	its file if there is one.
+*Parameters:
+	void
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+static void preparePattern555()
+{
+	pattern555 = findPartition("555");
+	loadPartition(pattern555);
+}
+
+/**
+*Name: evaluatePattern555
+*Purpose: This function will look a board up in the 555 partition.
+*Parameters:
+*	board --1d array containing the game board
+	state --state to fill in
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+static void evaluatePattern555(int board[BOARDSIZE], struct heuristicState *state)
+{
+	evaluatePattern(pattern555, 0, board, state);
+}
+
+/**
+*Name: updatePattern555
+*Purpose: This function will work out a child's 555 partition value from its parent's.
+*Parameters:
+*	parent --state of the parent board
+	child --state to fill in
+	board --the child board
+	tile --tile that moved
+	fromIndex --index it moved from
+	toIndex --index it moved to
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+static void updatePattern555(struct heuristicState *parent, struct heuristicState *child, int board[BOARDSIZE],
+	int tile, int fromIndex, int toIndex)
+{
+	updatePattern(pattern555, 0, parent, child, board, tile);
+}
+
+/**
+*Name: evaluateReflected555
+*Purpose: This function will look a board and its reflection up in the 555
+	partition and take the larger value.
+*Parameters:
+*	board --1d array containing the game board
+	state --state to fill in
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+static void evaluateReflected555(int board[BOARDSIZE], struct heuristicState *state)
+{
+	evaluatePattern(pattern555, 1, board, state);
+}
+
+/**
+*Name: updateReflected555
+*Purpose: This function will work out a child's 555 partition value and that
+	of its reflection from its parent's.
+*Parameters:
+*	parent --state of the parent board
+	child --state to fill in
+	board --the child board
+	tile --tile that moved
+	fromIndex --index it moved from
+	toIndex --index it moved to
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+static void updateReflected555(struct heuristicState *parent, struct heuristicState *child, int board[BOARDSIZE],
+	int tile, int fromIndex, int toIndex)
+{
+	updatePattern(pattern555, 1, parent, child, board, tile);
+}
+
+/**
+*Name: preparePattern663
+*Purpose: This function will load the tables of the 663 partition, from
+	its file if there is one.
+*Parameters:
+	void
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+static void preparePattern663()
+{
+	pattern663 = findPartition("663");
+	loadPartition(pattern663);
+}
+
+/**
+*Name: evaluatePattern663
+*Purpose: This function will look a board up in the 663 partition.
+*Parameters:
+*	board --1d array containing the game board
+	state --state to fill in
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+static void evaluatePattern663(int board[BOARDSIZE], struct heuristicState *state)
+{
+	evaluatePattern(pattern663, 0, board, state);
+}
+
+/**
+*Name: updatePattern663
+*Purpose: This function will work out a child's 663 partition value from its parent's.
+*Parameters:
+*	parent --state of the parent board
+	child --state to fill in
+	board --the child board
+	tile --tile that moved
+	fromIndex --index it moved from
+	toIndex --index it moved to
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+static void updatePattern663(struct heuristicState *parent, struct heuristicState *child, int board[BOARDSIZE],
+	int tile, int fromIndex, int toIndex)
+{
+	updatePattern(pattern663, 0, parent, child, board, tile);
+}
+
+/**
+*Name: evaluateReflected663
+*Purpose: This function will look a board and its reflection up in the 663
+	partition and take the larger value.
+*Parameters:
+*	board --1d array containing the game board
+	state --state to fill in
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+static void evaluateReflected663(int board[BOARDSIZE], struct heuristicState *state)
+{
+	evaluatePattern(pattern663, 1, board, state);
+}
+
+/**
+*Name: updateReflected663
+*Purpose: This function will work out a child's 663 partition value and that
+	of its reflection from its parent's.
+*Parameters:
+*	parent --state of the parent board
+	child --state to fill in
+	board --the child board
+	tile --tile that moved
+	fromIndex --index it moved from
+	toIndex --index it moved to
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+static void updateReflected663(struct heuristicState *parent, struct heuristicState *child, int board[BOARDSIZE],
+	int tile, int fromIndex, int toIndex)
+{
+	updatePattern(pattern663, 1, parent, child, board, tile);
+}
+
+struct heuristic heuristics[] =							//every heuristic, by name
+{
+	{"manhattan", prepareManhattan, evaluateManhattan, updateManhattan},
+	{"conflict", prepareConflict, evaluateConflict, updateConflict},
+	{"walking", prepareWalking, evaluateWalking, updateWalking},
+	{"pdb555", preparePattern555, evaluatePattern555, updatePattern555},
+	{"pdb663", preparePattern663, evaluatePattern663, updatePattern663},
+	{"pdb555r", preparePattern555, evaluateReflected555, updateReflected555},
+	{"pdb663r", preparePattern663, evaluateReflected663, updateReflected663}
+};
+
+#define HEURISTICCOUNT (int) (sizeof(heuristics) / sizeof(heuristics[0]))
+
+/**
+*Name: findHeuristic
+*Purpose: This function will, given the name of a heuristic, return it.
+	The tables the heuristic needs are built the first time it is found.
+*Parameters:
+*	name --manhattan, conflict, walking, pdb555, pdb663, pdb555r or pdb663r
+*Returns:
+	pointer to the heuristic
+	NULL if there is none with that name
+*Author: Andrew Gendreau
+**/
+struct heuristic *findHeuristic(char *name)
+{
+	int i;									//loop control variable
+
+	for(i = 0; i < HEURISTICCOUNT; i++)
+	{
+		if(strcmp(name, heuristics[i].name) == 0)
+		{
+			heuristics[i].prepare();
+			return &heuristics[i];
+		}
+	}
+
+	return NULL;
+}
+
+/**
+*Name: heuristicNames
+*Purpose: This function will return the names of every heuristic, separated
+	by |, for usage messages.
+*Parameters:
+	void
+*Returns:
+	the names
+*Author: Andrew Gendreau
+**/
+char *heuristicNames()
+{
+	return "manhattan|conflict|walking|pdb555|pdb663|pdb555r|pdb663r";
+}
@@ -0,0 +1,98 @@
+/*NAME: heuristic.h
+DATE: Oct 17th 2026
+VERSION: 1.0
+FILENAME: heuristic.h
+PURPOSE: This is a header for heuristic.c
+AUTHOR: Andrew Gendreau
+*/
+
+#ifndef PATH_H_
+#define PATH_H_
+#include "pathfinder.h"
+#endif
+
+#ifndef PATTERNFILE_H_
+#define PATTERNFILE_H_
+#include "patternFile.h"
+#endif
+
+#define LINECOUNT (BOARDWIDTH + BOARDHEIGHT)			//rows then columns, the lines linear conflict looks at
+#define LINECODES 625						//5^4, every way a line can hold tiles that belong in it
+#define NOTINLINE 4						//line code entry for a cell whose tile belongs in another line
+#define WALKINGSIDES 2						//a walking distance move brings a tile from above or below
+#define WALKINGFROMABOVE 0
+#define WALKINGFROMBELOW 1
+#define NOWALKINGSTATE -1					//transition to a walking distance state that can not happen
+
+/*
+	This is a struct for the value of a heuristic on one board, along with the
+	parts it was added up from, so the value for a child board can be worked out
+	from its parent's parts and the one tile that moved. Each heuristic only
+	uses the parts it needs.
+*/
+struct heuristicState
+{
+	int value;						//lower bound on the moves left
+	int manhattan;						//Manhattan distance of the board
+	int conflictTotal;					//sum of lineConflicts
+	unsigned char lineConflicts[LINECOUNT];			//tiles that have to leave each row, then each column
+	int walkingRows;					//walking distance state index of the rows
+	int walkingColumns;					//walking distance state index of the columns
+	unsigned long patternRanks[MAXPATTERNGROUPS];		//rank of each group of a pattern database partition
+	unsigned long reflectedRanks[MAXPATTERNGROUPS];		//rank of each group on the reflected board
+	int patternSum;						//sum of the entries of patternRanks
+	int reflectedSum;					//sum of the entries of reflectedRanks
+};
+
+/*
+	This is a struct for one heuristic the solver can use. prepare builds any
+	tables it needs, evaluate works the state out for a whole board, for the root,
+	and update works out a child's state from its parent's after tile has moved
+	from one index to the other. The board given to update is the child's board.
+*/
+struct heuristic
+{
+	char *name;						//name it is picked by
+	void (*prepare)();
+	void (*evaluate)(int board[BOARDSIZE], struct heuristicState *state);
+	void (*update)(struct heuristicState *parent, struct heuristicState *child, int board[BOARDSIZE],
+		int tile, int fromIndex, int toIndex);
+};
+
+/**
+*Name: findHeuristic
+*Purpose: This function will, given the name of a heuristic, return it.
+	The tables the heuristic needs are built the first time it is found.
+*Parameters:
+*	name --manhattan, conflict, walking, pdb555, pdb663, pdb555r or pdb663r
+*Returns:
+	pointer to the heuristic
+	NULL if there is none with that name
+*Author: Andrew Gendreau
+**/
+struct heuristic *findHeuristic(char *name);
+
+/**
+*Name: heuristicNames
+*Purpose: This function will return the names of every heuristic, separated
+	by |, for usage messages.
+*Parameters:
+	void
+*Returns:
+	the names
+*Author: Andrew Gendreau
+**/
+char *heuristicNames();
+
+/**
+*Name: manhattanDistance
+*Purpose: This function will, given a board, add up how many rows and columns
+	every tile is away from where it belongs. No tile can get home in fewer
+	moves than that, so it never overestimates the moves left.
+*Parameters:
+*	board --1d array containing the game board
+*Returns:
+	the sum of the distances of the tiles, the blank not counted
+*Author: Andrew Gendreau
+**/
+int manhattanDistance(int board[BOARDSIZE]);
@@ -0,0 +1,424 @@
+/*NAME: idaStar.c
+DATE: Oct 17th 2026
+VERSION: 1.0
+FILENAME: idaStar.c
+PURPOSE: This module will be the iterative deepening A* engine. The breadth first
+	search keeps every board it has made, so its memory grows with the number of boards
+	at each depth and it can not go much past 20 moves. This engine instead runs a depth
+	first search over one board that is changed in place and put back as the search
+	backs out, so it only ever holds the boards on the current path.
+	Each pass of the search has a bound, and a board is not expanded if the moves made
+	to reach it plus a lower bound on the moves still needed is more than that bound.
+	The lower bound is one of the heuristics in heuristic.c, the Manhattan distance
+	unless another is picked. The first bound is the root's lower bound, and every pass
+	that fails raises it to the smallest total that was over it, so the first pass
+	that reaches the goal finds a shortest path.
+	The lower bound is not recomputed for every board, the state of the board at each
+	depth is kept and a child's is worked out from its parent's and the tile that moved.
+	Everything one search changes is kept in its own idaSearch, so the parallel
+	engine can run one in each thread over different parts of the same pass.
+	The perimeter search first puts every board within a set number of moves of the
+	goal, the perimeter depth, in a hash map with its distance. A board that is not in
+	the map is at least one more move than that from the goal, so its lower bound can
+	be raised to that, and a board that is in it has an exact distance and a path to
+	the goal that can be read back out, so the pass is over as soon as one is reached.
+	Each pass then only has to search down to the perimeter rather than to the goal,
+	which cuts off the deepest and largest levels of every pass, for the memory the
+	map takes. The depth is set with -k, each level is a little under three times as big.
+AUTHOR: Andrew Gendreau
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifndef IDASTAR_H_
+#define IDASTAR_H_
+#include "idaStar.h"
+#endif
+
+#ifndef BOARDKEY_H_
+#define BOARDKEY_H_
+#include "boardKey.h"
+#endif
+
+#ifndef HASH_H_
+#define HASH_H_
+#include "hashList.h"
+#endif
+
+#ifndef HEURISTIC_H_
+#define HEURISTIC_H_
+#include "heuristic.h"
+#endif
+
+#ifndef ENDGAMETABLE_H_
+#define ENDGAMETABLE_H_
+#include "endgameTable.h"
+#endif
+
+#ifndef MEMORY_H_
+#define MEMORY_H_
+#include "memoryTracker.h"
+#endif
+
+#ifndef SEARCHLIMITS_H_
+#define SEARCHLIMITS_H_
+#include "searchLimits.h"
+#endif
+
+struct idaSearch idaSerial;							//the search idaStarSolve runs
+atomic_int idaSerialStop;							//its stop flag, only a search limit sets it
+unsigned long long idaNodesExpanded = 0;					//nodes expanded over every pass of the last solve
+struct heuristic *idaHeuristic = NULL;						//lower bound the search uses, Manhattan distance if NULL
+struct hashList *idaPerimeter = NULL;						//boards near the goal and their entries, NULL for no perimeter
+int idaPerimeterDepth = DEFAULTPERIMETERDEPTH;					//moves from the goal the perimeter reaches
+
+/**
+*Name: boundedSearch
+*Purpose: This function will run one pass of the depth first search from
+	the search's board, which is moves moves from the root and whose lower
+	bound is in states[moves]. It will try every move but the one that undoes
+	lastDirection, making it on the board, searching from there and then
+	undoing it, and it will not go past boards whose total is over bound.
+	If there is a perimeter and the board is in it the search stops there.
+	If the search has a stop flag and another thread sets it, it backs out.
+	Every LIMITCHECKNODES nodes it charges the search limits, and if one is
+	reached it sets its stop flag to STOPPEDATLIMIT and backs out the same way.
+*Parameters: 
+*	search --search to run, its board, blank, key and states[moves] filled in
+	moves --moves made from the root to the board
+	bound --largest total moves plus estimate this pass will expand
+	lastDirection --direction of the move into the board, NOMOVE at the root
+*Returns:
+	FOUNDSOLUTION if the goal was reached, search->path then holds the path
+	otherwise the smallest total over bound that was seen, NOBOUND if none or if it was stopped
+*Author: Andrew Gendreau
+**/
+int boundedSearch(struct idaSearch *search, int moves, int bound, int lastDirection)
+{
+	int blankIndex;								//index of the blank on the board
+	int tileIndex;								//index of the tile we are moving
+	int tile;								//the tile we are moving
+	int direction;								//direction it moves in
+	int estimate;								//lower bound on the moves left from the board
+	int result;								//what the search below the move returned
+	int nextBound;								//smallest total over bound seen so far
+	int entry;								//the board's entry in the perimeter
+	int expected;								//stop flag before a limit sets it
+	boardKey key;								//key of the board
+	int i;									//loop control variable
+
+	estimate = search->states[moves].value;
+	key = search->key;
+
+	if(idaPerimeter != NULL && estimate <= idaPerimeterDepth)		//farther out it can not be in the perimeter
+	{
+		entry = endgameMapEntry(idaPerimeter, key);
+
+		if(entry != NOTINENDGAME && moves + ENDGAMEDISTANCE(entry) > bound)
+		{
+			return moves + ENDGAMEDISTANCE(entry);
+		}
+
+		if(entry != NOTINENDGAME)
+		{
+			search->path.length = moves;
+			endgameMapPath(idaPerimeter, key, search->blank, &search->path);
+			return FOUNDSOLUTION;
+		}
+
+		/*
+		* It is outside the perimeter, so it is more than idaPerimeterDepth moves
+		* from the goal. Every move moves one tile one place, so the real distance
+		* and every one of the lower bounds are even or odd together, and keeping
+		* that keeps the bounds of the passes going up by two.
+		*/
+		if(estimate <= idaPerimeterDepth)
+		{
+			estimate = idaPerimeterDepth + 1 + ((idaPerimeterDepth + 1 - estimate) & 1);
+		}
+	}
+
+	if(moves + estimate > bound)
+	{
+		return moves + estimate;
+	}
+
+	if(estimate == 0 && key == WINNINGHASH)
+	{
+		search->path.length = moves;
+		return FOUNDSOLUTION;
+	}
+
+	if(moves == MAXPATHLENGTH)
+	{
+		return NOBOUND;
+	}
+
+	if(search->stop != NULL && atomic_load_explicit(search->stop, memory_order_relaxed) != 0)
+	{
+		return NOBOUND;
+	}
+
+	search->nodesExpanded++;
+
+	if(search->stop != NULL && search->nodesExpanded % LIMITCHECKNODES == 0
+		&& chargeSearchLimits(LIMITCHECKNODES, bound) != LIMITNONE)
+	{
+		expected = 0;
+		atomic_compare_exchange_strong(search->stop, &expected, STOPPEDATLIMIT);	//unless the goal was reached first
+		return NOBOUND;
+	}
+
+	blankIndex = search->blank;
+	nextBound = NOBOUND;
+
+	for(i = 0; i < movesForBlank[blankIndex]; i++)
+	{
+		direction = directionsForBlank[blankIndex][i];
+
+		if(lastDirection != NOMOVE && direction == (lastDirection ^ 1))	//that would put the last tile back
+		{
+			continue;
+		}
+
+		tileIndex = tilesForBlank[blankIndex][i];
+		tile = search->board[tileIndex];
+
+		search->board[blankIndex] = tile;					//make the move
+		search->board[tileIndex] = 0;
+		search->blank = tileIndex;
+		search->key = applyMoveToKey(key, blankIndex, tileIndex);
+		search->path.moves[moves] = MOVECODE(tile, direction);
+		idaHeuristic->update(&search->states[moves], &search->states[moves + 1], search->board, tile,
+			tileIndex, blankIndex);
+
+		result = boundedSearch(search, moves + 1, bound, direction);
+
+		search->board[tileIndex] = tile;					//and undo it
+		search->board[blankIndex] = 0;
+		search->blank = blankIndex;
+		search->key = key;
+
+		if(result == FOUNDSOLUTION)
+		{
+			return FOUNDSOLUTION;
+		}
+
+		if(result < nextBound)
+		{
+			nextBound = result;
+		}
+	}
+
+	return nextBound;
+}
+
+/**
+*Name: setIdaHeuristic
+*Purpose: This function will, given a heuristic, make it the lower bound
+	the search uses from then on.
+*Parameters: 
+*	heuristic --heuristic to use, from findHeuristic
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void setIdaHeuristic(struct heuristic *heuristic)
+{
+	idaHeuristic = heuristic;
+}
+
+/**
+*Name: setIdaPerimeter
+*Purpose: This function will, given a depth, build a perimeter of every board
+	that many moves from the goal or fewer for the search to stop at, in place of
+	any it had. A depth below 0 takes the perimeter away.
+*Parameters: 
+*	depth --moves from the goal the perimeter reaches, at most MAXENDGAMEDEPTH
+*Returns:
+	the number of boards in the perimeter
+*Author: Andrew Gendreau
+**/
+unsigned long setIdaPerimeter(int depth)
+{
+	if(idaPerimeter != NULL)
+	{
+		destroyHashList(idaPerimeter);
+		idaPerimeter = NULL;
+	}
+
+	if(depth < 0)
+	{
+		return 0;
+	}
+
+	idaPerimeterDepth = depth;
+	idaPerimeter = buildEndgameMap(depth);
+
+	return idaPerimeter->count;
+}
+
+/**
+*Name: startIdaSearch
+*Purpose: This function will, given a search and a board, set the search up
+	at the root of that board, picking the Manhattan distance as the lower
+	bound if none has been picked yet.
+*Parameters: 
+*	search --search to set up
+	board --1d array containing the game board, it is copied
+	stop --flag set to stop the search, by another thread or a search limit,
+		NULL for neither, the limits are then not charged
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void startIdaSearch(struct idaSearch *search, int board[BOARDSIZE], atomic_int *stop)
+{
+	if(idaHeuristic == NULL)
+	{
+		idaHeuristic = findHeuristic("manhattan");
+	}
+
+	memcpy(search->board, board, sizeof(search->board));
+	search->blank = findBlankIndex(search->board);
+	search->key = encodeBoard(search->board);
+	search->path.length = 0;
+	search->nodesExpanded = 0;
+	search->stop = stop;
+
+	idaHeuristic->evaluate(search->board, &search->states[0]);
+}
+
+/**
+*Name: idaStarSolve
+*Purpose: This function will, given a solvable board, find a shortest
+	path to the winning state with iterative deepening A*, and fill path
+	with its moves. It will start the bound at the root's lower bound
+	and run passes of boundedSearch, raising the bound each time, until one
+	reaches the goal, the bound passes MAXPATHLENGTH or a search limit is
+	reached, in which case no path is shorter than the bound of the pass.
+*Parameters: 
+*	board --1d array containing the game board, it is left as it was
+	path --path to fill
+*Returns:
+	the number of moves on the path
+	-1 if there is no path of MAXPATHLENGTH moves or fewer
+	LIMITREACHED if a search limit was reached
+*Author: Andrew Gendreau
+**/
+int idaStarSolve(int board[BOARDSIZE], struct movePath *path)
+{
+	int bound;								//bound of the current pass
+	int result;								//what the pass returned
+
+	atomic_store(&idaSerialStop, 0);
+	startIdaSearch(&idaSerial, board, &idaSerialStop);
+	bound = idaSerial.states[0].value;
+	result = NOBOUND;
+
+	while(bound <= MAXPATHLENGTH)
+	{
+		if(chargeSearchLimits(0, bound) != LIMITNONE)
+		{
+			atomic_store(&idaSerialStop, STOPPEDATLIMIT);
+			break;
+		}
+
+		result = boundedSearch(&idaSerial, 0, bound, NOMOVE);
+
+		if(result == FOUNDSOLUTION || atomic_load(&idaSerialStop) == STOPPEDATLIMIT)
+		{
+			break;
+		}
+
+		bound = result;
+	}
+
+	idaNodesExpanded = idaSerial.nodesExpanded;
+
+	if(result != FOUNDSOLUTION && atomic_load(&idaSerialStop) == STOPPEDATLIMIT)
+	{
+		path->length = 0;
+		return stopAtLimit(bound);
+	}
+
+	if(result == FOUNDSOLUTION)
+	{
+		memcpy(path, &idaSerial.path, sizeof(struct movePath));
+		return path->length;
+	}
+
+	path->length = 0;
+	return -1;
+}
+
+/**
+*Name: runIdaStar
+*Purpose: This function will, given a 1d array that represents the inital board state,
+	solve it with idaStarSolve and print the length of the path, its moves and
+	how many nodes were expanded finding it, or the search limit that stopped it.
+*Parameters: 
+	board --1d Int array to hold the root board
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void runIdaStar(int board[BOARDSIZE])
+{
+	struct movePath winningPath;						//the moves from the root to the goal
+	char winningMoves[PATHTEXTSIZE];					//text of those moves
+	int length;								//what the solve returned
+
+	length = idaStarSolve(board, &winningPath);
+
+	if(length == LIMITREACHED)
+	{
+		reportSearchLimit();
+		printf("Expanded %llu nodes\n", idaNodesExpanded);
+		return;
+	}
+
+	if(length < 0)
+	{
+		printf("There is no solution in %d moves or fewer\n", MAXPATHLENGTH);
+		return;
+	}
+
+	formatMovePath(&winningPath, winningMoves);
+
+	printf("It took %d moves\n", winningPath.length);
+	printf("The moves were: %s\n", winningMoves);
+	printf("Expanded %llu nodes\n", idaNodesExpanded);
+}
+
+/**
+*Name: runPerimeterSearch
+*Purpose: This function will, given a 1d array that represents the inital board state,
+	build the perimeter to idaPerimeterDepth, solve the board with idaStarSolve and
+	print the length of the path, its moves, how many nodes were expanded finding
+	it, how big the perimeter was and how long it took to build.
+*Parameters: 
+	board --1d Int array to hold the root board
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void runPerimeterSearch(int board[BOARDSIZE])
+{
+	unsigned long perimeterSize;						//boards in the perimeter
+	clock_t start;								//time the perimeter build started
+
+	start = clock();
+	perimeterSize = setIdaPerimeter(idaPerimeterDepth);
+
+	printf("Perimeter of depth %d holds %lu boards, built in %f seconds, heap %lu bytes\n",
+		idaPerimeterDepth, perimeterSize, (double) (clock() - start) / CLOCKS_PER_SEC,
+		(unsigned long) memoryUsage.currentBytes);
+
+	runIdaStar(board);
+
+	setIdaPerimeter(-1);
+}
@@ -0,0 +1,152 @@
+/*NAME: idaStar.h
+DATE: Oct 17th 2026
+VERSION: 1.0
+FILENAME: idaStar.h
+PURPOSE: This is a header for idaStar.c
+AUTHOR: Andrew Gendreau
+*/
+
+#include <stdatomic.h>
+
+#ifndef BOARDKEY_H_
+#define BOARDKEY_H_
+#include "boardKey.h"
+#endif
+
+#ifndef MOVEPATH_H_
+#define MOVEPATH_H_
+#include "movePath.h"
+#endif
+
+#ifndef HEURISTIC_H_
+#define HEURISTIC_H_
+#include "heuristic.h"
+#endif
+
+#define FOUNDSOLUTION -1					//returned by the depth first search once it reaches the goal
+#define NOBOUND 1000						//larger than any bound the search can need
+#define STOPPEDATLIMIT 2					//stop flag of a search a search limit stopped
+#define DEFAULTPERIMETERDEPTH 16				//depth of the perimeter if -k is not given
+
+/*
+	This is a struct for one depth first search, the board it changes in place
+	and puts back as it backs out, the moves that led to it and the lower bound
+	of each board on the way.
+*/
+struct idaSearch
+{
+	int board[BOARDSIZE];					//the board the search is changing
+	int blank;						//1d index of the blank on board
+	boardKey key;						//key of board
+	struct movePath path;					//moves from the root to board
+	struct heuristicState states[MAXPATHLENGTH + 1];	//lower bound of each board on the path, by moves from the root
+	unsigned long long nodesExpanded;			//nodes this search has expanded
+	atomic_int *stop;					//set to stop the search, NULL if nothing can
+};
+
+/**
+*Name: setIdaHeuristic
+*Purpose: This function will, given a heuristic, make it the lower bound
+	the search uses from then on.
+*Parameters: 
+*	heuristic --heuristic to use, from findHeuristic
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void setIdaHeuristic(struct heuristic *heuristic);
+
+/**
+*Name: setIdaPerimeter
+*Purpose: This function will, given a depth, build a perimeter of every board
+	that many moves from the goal or fewer for the search to stop at, in place of
+	any it had. A depth below 0 takes the perimeter away.
+*Parameters: 
+*	depth --moves from the goal the perimeter reaches, at most MAXENDGAMEDEPTH
+*Returns:
+	the number of boards in the perimeter
+*Author: Andrew Gendreau
+**/
+unsigned long setIdaPerimeter(int depth);
+
+/**
+*Name: boundedSearch
+*Purpose: This function will run one pass of the depth first search from
+	the search's board, which is moves moves from the root and whose lower
+	bound is in states[moves]. It will try every move but the one that undoes
+	lastDirection, making it on the board, searching from there and then
+	undoing it, and it will not go past boards whose total is over bound.
+	If there is a perimeter and the board is in it the search stops there.
+	If the search has a stop flag and another thread sets it, it backs out.
+	Every LIMITCHECKNODES nodes it charges the search limits, and if one is
+	reached it sets its stop flag to STOPPEDATLIMIT and backs out the same way.
+*Parameters: 
+*	search --search to run, its board, blank, key and states[moves] filled in
+	moves --moves made from the root to the board
+	bound --largest total moves plus estimate this pass will expand
+	lastDirection --direction of the move into the board, NOMOVE at the root
+*Returns:
+	FOUNDSOLUTION if the goal was reached, search->path then holds the path
+	otherwise the smallest total over bound that was seen, NOBOUND if none or if it was stopped
+*Author: Andrew Gendreau
+**/
+int boundedSearch(struct idaSearch *search, int moves, int bound, int lastDirection);
+
+/**
+*Name: startIdaSearch
+*Purpose: This function will, given a search and a board, set the search up
+	at the root of that board, picking the Manhattan distance as the lower
+	bound if none has been picked yet.
+*Parameters: 
+*	search --search to set up
+	board --1d array containing the game board, it is copied
+	stop --flag set to stop the search, by another thread or a search limit,
+		NULL for neither, the limits are then not charged
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void startIdaSearch(struct idaSearch *search, int board[BOARDSIZE], atomic_int *stop);
+
+/**
+*Name: idaStarSolve
+*Purpose: This function will, given a solvable board, find a shortest
+	path to the winning state with iterative deepening A*, and fill path
+	with its moves.
+*Parameters: 
+*	board --1d array containing the game board, it is left as it was
+	path --path to fill
+*Returns:
+	the number of moves on the path
+	-1 if there is no path of MAXPATHLENGTH moves or fewer
+	LIMITREACHED if a search limit was reached
+*Author: Andrew Gendreau
+**/
+int idaStarSolve(int board[BOARDSIZE], struct movePath *path);
+
+/**
+*Name: runIdaStar
+*Purpose: This function will, given a 1d array that represents the inital board state,
+	solve it with idaStarSolve and print the length of the path, its moves and
+	how many nodes were expanded finding it, or the search limit that stopped it.
+*Parameters: 
+	board --1d Int array to hold the root board
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void runIdaStar(int board[BOARDSIZE]);
+
+/**
+*Name: runPerimeterSearch
+*Purpose: This function will, given a 1d array that represents the inital board state,
+	build the perimeter to idaPerimeterDepth, solve the board with idaStarSolve and
+	print the length of the path, its moves, how many nodes were expanded finding
+	it, how big the perimeter was and how long it took to build.
+*Parameters: 
+	board --1d Int array to hold the root board
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void runPerimeterSearch(int board[BOARDSIZE]);
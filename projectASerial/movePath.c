@@ -0,0 +1,76 @@
+/*NAME: movePath.c
+DATE: Oct 17th 2026
+VERSION: 1.0
+FILENAME: movePath.c
+PURPOSE: This module will hold the winning path of a search. The path is
+	filled in as move codes, one byte a move, by walking up from the winning
+	node once, and is only written out as text when it is going to be printed.
+AUTHOR: Andrew Gendreau
+*/
+
+#ifndef MOVEPATH_H_
+#define MOVEPATH_H_
+#include "movePath.h"
+#endif
+
+/**
+*Name: formatMoveCodes
+*Purpose: This function will, given a run of move codes, write it into text as
+	moves like 4U 8L with a space between moves, in one pass over the codes.
+*Parameters: 
+*	moves --the move codes, first to last
+	count --number of them
+	text --buffer to write into, count * MOVETEXTSIZE + 1 characters is always enough
+*Returns:
+	the number of characters written, not counting the null terminator
+*Author: Andrew Gendreau
+**/
+int formatMoveCodes(moveCode *moves, int count, char *text)
+{
+	int i;									//loop control variable
+	int length;								//characters written so far
+	int tile;								//tile moved by the current move
+
+	length = 0;
+
+	for(i = 0; i < count; i++)
+	{
+		if(i > 0)
+		{
+			text[length] = ' ';
+			length++;
+		}
+
+		tile = CODETILE(moves[i]);
+
+		if(tile >= 10)							//tiles 10 to 15 take two digits
+		{
+			text[length] = '0' + tile / 10;
+			length++;
+		}
+
+		text[length] = '0' + tile % 10;
+		text[length + 1] = DIRECTIONLETTERS[CODEDIRECTION(moves[i])];
+		length += 2;
+	}
+
+	text[length] = '\0';
+
+	return length;
+}
+
+/**
+*Name: formatMovePath
+*Purpose: This function will, given a path, write it into text as moves like
+	4U 8L with a space between moves, in one pass over the path.
+*Parameters: 
+*	path --path to write out
+	text --buffer to write into, PATHTEXTSIZE characters is always enough
+*Returns:
+	the number of characters written, not counting the null terminator
+*Author: Andrew Gendreau
+**/
+int formatMovePath(struct movePath *path, char *text)
+{
+	return formatMoveCodes(path->moves, path->length, text);
+}
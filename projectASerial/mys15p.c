@@ -16,6 +16,7 @@ AUTHOR: Andrew Gendreau
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
+#include <unistd.h>
 
 #ifndef SOLVER_H_
 #define SOLVER_H_
@@ -32,16 +33,352 @@ AUTHOR: Andrew Gendreau
 #include "functions-2.h"
 #endif
 
+#ifndef IDASTAR_H_
+#define IDASTAR_H_
+#include "idaStar.h"
+#endif
+
+#ifndef BIDIRECTIONAL_H_
+#define BIDIRECTIONAL_H_
+#include "bidirectional.h"
+#endif
+
+#ifndef ENDGAMETABLE_H_
+#define ENDGAMETABLE_H_
+#include "endgameTable.h"
+#endif
+
+#ifndef PARALLELBFS_H_
+#define PARALLELBFS_H_
+#include "parallelBfs.h"
+#endif
+
+#ifndef PARALLELIDA_H_
+#define PARALLELIDA_H_
+#include "parallelIda.h"
+#endif
+
+#ifndef ASTAR_H_
+#define ASTAR_H_
+#include "aStar.h"
+#endif
+
+#ifndef ANYTIMESEARCH_H_
+#define ANYTIMESEARCH_H_
+#include "anytimeSearch.h"
+#endif
+
+#ifndef CONSTRUCTIVE_H_
+#define CONSTRUCTIVE_H_
+#include "constructiveSolver.h"
+#endif
+
+#ifndef SEARCHLIMITS_H_
+#define SEARCHLIMITS_H_
+#include "searchLimits.h"
+#endif
+
 #define LINESIZE 200							//arbitary limit on user fileName
 
+extern int leanSearch;							//1 to release the nodes of finished levels
+extern int idaPerimeterDepth;						//moves from the goal the perimeter search stops at
+extern int parallelThreads;						//worker threads of the parallel searches
+extern int anytimeDeadline;						//milliseconds the anytime search runs for
+extern int anytimeStartWeight;						//weight it starts with, in tenths
+extern int constructivePrune;						//1 to take the redundant pairs out of a constructive path
+
+/*
+	This is a struct for one of the search engines the solver can run, the
+	name it is picked by on the command line and the function that runs it.
+*/
+struct engine
+{
+	char *name;							//name given to -e
+	void (*run)(int board[BOARDSIZE]);				//function that solves and reports on a board
+};
+
+struct engine engines[] =					//every engine, the first is the default
+{
+	{"bfs", runTest},
+	{"ida", runIdaStar},
+	{"bidir", runBidirectional},
+	{"perimeter", runPerimeterSearch},
+	{"parallel", runParallelBfs},
+	{"pida", runParallelIda},
+	{"astar", runAStar},
+	{"pastar", runPartialAStar},
+	{"anytime", runAnytime},
+	{"constructive", runConstructive}
+};
+
+#define ENGINECOUNT (int) (sizeof(engines) / sizeof(engines[0]))
+
+/**
+*Name: generateTables
+*Purpose: This function will build the tables of a pattern database partition
+	and write them to a file, the partition's default file if no name is given,
+	so later runs can map them instead of building them. It then maps the file
+	back and checks the checksum of every table.
+*Parameters: 
+	partitionName --name of the partition to build
+	fileName --file to write, NULL for the default
+*Returns:
+	0 if the file was written and checked, 1 if not
+*Author: Andrew Gendreau
+**/
+static int generateTables(char *partitionName, char *fileName)
+{
+	struct partition *partition;					//partition being built
+	char defaultName[PATTERNFILENAMESIZE];				//default file of the partition
+	clock_t start;							//time the build started
+	int result;							//what writing or mapping the file returned
+
+	partition = findPartition(partitionName);
+
+	if(partition == NULL)
+	{
+		printf("There is no partition called %s\n", partitionName);
+		return 1;
+	}
+
+	if(fileName == NULL)
+	{
+		patternFileName(partition, defaultName);
+		fileName = defaultName;
+	}
+
+	start = clock();
+	buildPartition(partition);
+
+	result = writePatternFile(partition, fileName);
+
+	if(result == PATTERNFILEOK)
+	{
+		releasePartition(partition);
+		result = mapPatternFile(partition, fileName);
+	}
+
+	if(result == PATTERNFILEOK)
+	{
+		result = verifyPatternFile(partition);
+	}
+
+	if(result != PATTERNFILEOK)
+	{
+		printf("%s %s\n", fileName, patternFileError(result));
+		return 1;
+	}
+
+	printf("Wrote %s, %lu bytes, in %f seconds\n", fileName, (unsigned long) partition->mappingSize,
+		(double) (clock() - start) / CLOCKS_PER_SEC);
+
+	releasePartition(partition);
+	return 0;
+}
+
+/**
+*Name: generateEndgame
+*Purpose: This function will generate the endgame table to the given depth
+	and write it to a file, ENDGAMEFILENAME if no name is given. It then
+	maps the file back and checks its checksum.
+*Parameters: 
+	depth --moves from the goal the table should reach
+	fileName --file to write, NULL for the default
+*Returns:
+	0 if the file was written and checked, 1 if not
+*Author: Andrew Gendreau
+**/
+static int generateEndgame(int depth, char *fileName)
+{
+	struct endgameTable table;					//the table mapped back from the file
+	long long entryCount;						//boards written
+	clock_t start;							//time the generation started
+	int result;							//what mapping the file returned
+
+	if(depth < 1 || depth > MAXENDGAMEDEPTH)
+	{
+		printf("The depth has to be from 1 to %d\n", MAXENDGAMEDEPTH);
+		return 1;
+	}
+
+	if(fileName == NULL)
+	{
+		fileName = ENDGAMEFILENAME;
+	}
+
+	start = clock();
+	entryCount = generateEndgameTable(depth, fileName);
+
+	if(entryCount < 0)
+	{
+		printf("%s %s\n", fileName, patternFileError(PATTERNFILEWRITEFAILED));
+		return 1;
+	}
+
+	result = mapEndgameTable(&table, fileName);
+
+	if(result == PATTERNFILEOK)
+	{
+		result = verifyEndgameTable(&table);
+
+		if(result != PATTERNFILEOK)
+		{
+			releaseEndgameTable(&table);
+		}
+	}
+
+	if(result != PATTERNFILEOK)
+	{
+		printf("%s %s\n", fileName, patternFileError(result));
+		return 1;
+	}
+
+	printf("Wrote %s, %lld boards to depth %d, %lu bytes, in %f seconds\n", fileName, entryCount, depth,
+		(unsigned long) table.mappingSize, (double) (clock() - start) / CLOCKS_PER_SEC);
+
+	releaseEndgameTable(&table);
+	return 0;
+}
+
+/**
+*Name: verifyTables
+*Purpose: This function will map the tables of a pattern database partition
+	from a file, the partition's default file if no name is given, and check
+	its header, its size and the checksum of every table, which a run of the
+	solver does not take the time to.
+*Parameters: 
+	partitionName --name of the partition the file is for
+	fileName --file to check, NULL for the default
+*Returns:
+	0 if the file is valid, 1 if not
+*Author: Andrew Gendreau
+**/
+static int verifyTables(char *partitionName, char *fileName)
+{
+	struct partition *partition;					//partition the file is for
+	char defaultName[PATTERNFILENAMESIZE];				//default file of the partition
+	int result;							//what mapping and checking it returned
+
+	partition = findPartition(partitionName);
+
+	if(partition == NULL)
+	{
+		printf("There is no partition called %s\n", partitionName);
+		return 1;
+	}
+
+	if(fileName == NULL)
+	{
+		patternFileName(partition, defaultName);
+		fileName = defaultName;
+	}
+
+	result = mapPatternFile(partition, fileName);
+
+	if(result == PATTERNFILEOK)
+	{
+		result = verifyPatternFile(partition);
+		releasePartition(partition);
+	}
+
+	printf("%s %s\n", fileName, patternFileError(result));
+
+	return result == PATTERNFILEOK ? 0 : 1;
+}
+
+/**
+*Name: verifyEndgame
+*Purpose: This function will map an endgame table file, ENDGAMEFILENAME if no
+	name is given, and check its header, its size and its checksum, which a
+	run of the solver does not take the time to.
+*Parameters: 
+	fileName --file to check, NULL for the default
+*Returns:
+	0 if the file is valid, 1 if not
+*Author: Andrew Gendreau
+**/
+static int verifyEndgame(char *fileName)
+{
+	struct endgameTable table;					//the table mapped from the file
+	int result;							//what mapping and checking it returned
+
+	if(fileName == NULL)
+	{
+		fileName = ENDGAMEFILENAME;
+	}
+
+	result = mapEndgameTable(&table, fileName);
+
+	if(result == PATTERNFILEOK)
+	{
+		result = verifyEndgameTable(&table);
+		releaseEndgameTable(&table);
+	}
+
+	printf("%s %s\n", fileName, patternFileError(result));
+
+	return result == PATTERNFILEOK ? 0 : 1;
+}
+
+/**
+*Name: solveFromEndgame
+*Purpose: This function will, given an endgame table and a board, print the
+	path to the goal if the table holds the board.
+*Parameters: 
+	table --table to look in, it may have nothing mapped
+	board --1d array containing the game board
+*Returns:
+	1 if the board was answered from the table, 0 if it has to be searched
+*Author: Andrew Gendreau
+**/
+static int solveFromEndgame(struct endgameTable *table, int board[BOARDSIZE])
+{
+	struct movePath winningPath;					//the moves from the root to the goal
+	char winningMoves[PATHTEXTSIZE];				//text of those moves
+
+	if(encodeBoard(board) == WINNINGHASH || endgamePath(table, board, &winningPath) < 0)
+	{
+		return 0;
+	}
+
+	formatMovePath(&winningPath, winningMoves);
+
+	printf("It took %d moves\n", winningPath.length);
+	printf("The moves were: %s\n", winningMoves);
+	printf("Answered from the endgame table, no search was run\n");
+
+	return 1;
+}
+
 /**
 *Name: main
-*Purpose: This function will run the serial version. It will do this by first
-	reading in the input from a given input file. It will then run the solvability
-	test module on the given input after converting it to a 1D form. If the given 
-	board is not solvable, it will tell the user and die. If it is solvable, it will
-	run the algorithm on the given board.
-	
+*Purpose: This function will read a board from the file named on stdin, turn it
+	away if it is not 4 rows of 4 tiles with every tile from 0 to 15 once or it
+	is not solvable, and solve it with the chosen engine otherwise.
+	Options:
+	-l --run a lean breadth first search, releasing each level once it is done with,
+		it holds less than a full one from about 12 moves, a little more below that
+	-r --shorten a constructive path by taking out moves undone right after them
+	-e engine --bfs (the default), ida, bidir, perimeter, parallel, pida, astar,
+		pastar, anytime or constructive
+	-H heuristic --lower bound of ida, perimeter, pida, astar, pastar and anytime,
+		manhattan, conflict, walking, pdb555, pdb663, pdb555r or pdb663r
+	-k depth --moves from the goal the perimeter engine stops at (default 16)
+	-t threads --worker threads of parallel and pida (default 4)
+	-d milliseconds --how long anytime lowers its weight for (default 10)
+	-w weight --weight anytime starts at (default 3.0)
+	-D depth --longest path to look for
+	-N nodes --most nodes to expand
+	-M megabytes --most heap to hold at once
+	-S seconds --most time to run for
+	-T endgameFile --answer a board the endgame table holds from it, with no search
+	A search stopped by -D, -N, -M or -S says which and the fewest moves a path
+	can have. constructive does not search, so it takes no limits.
+	Commands:
+	generate 555|663 [fileName] --build a pattern database partition and save it
+	endgame [depth] [fileName] --build the endgame table (default ENDGAMEFILENAME)
+	verify 555|663|endgame [fileName] --check a saved file against its checksums,
+		which loading it does not
 *Parameters: 
 	int argc --Main parameter, this is a count of command line arguements
 	char *argv[] --Main parameter, this is a pointer to an array of pointers.
@@ -55,7 +392,7 @@ int main(int argc, char *argv[])
 									//in the form of a file.
 	FILE *filePointer;						//pointer to the input file
 	int solvableTest;						//return from the solvability test
-	int oneDInputBoard[BOARDWIDTH];					//variable to hold the 1D form of the given input board
+	int oneDInputBoard[BOARDSIZE];					//variable to hold the 1D form of the given input board
 	char userInput[LINESIZE];					//character array to hold the user's given fileNames
 	char currentChar;						//current character in the user input
 	int i;								//loop control variable
@@ -65,6 +402,196 @@ int main(int argc, char *argv[])
 	double millSeconds;						//time it took in milliseconds
 	int blankPositionFromBottom;
 	double seconds;
+	int option;							//current command line option
+	struct engine *chosenEngine;					//engine we will solve with
+	struct heuristic *chosenHeuristic;				//lower bound the informed engines use
+	struct endgameTable endgame;					//table of the boards close to the goal
+	char *endgameName;						//file it is mapped from
+	int endgameResult;						//what mapping it returned
+	int readResult;							//what reading the input file returned
+
+	chosenEngine = &engines[0];
+	endgameName = NULL;
+
+	while((option = getopt(argc, argv, "lre:H:T:k:t:d:w:D:N:M:S:")) != -1)
+	{
+		if(option == 'l')
+		{
+			leanSearch = 1;
+		}
+		else if(option == 'r')
+		{
+			constructivePrune = 1;
+		}
+		else if(option == 'e')
+		{
+			chosenEngine = NULL;
+
+			for(i = 0; i < ENGINECOUNT; i++)
+			{
+				if(strcmp(optarg, engines[i].name) == 0)
+				{
+					chosenEngine = &engines[i];
+				}
+			}
+
+			if(chosenEngine == NULL)
+			{
+				printf("There is no engine called %s\n", optarg);
+				return 1;
+			}
+		}
+		else if(option == 'H')
+		{
+			chosenHeuristic = findHeuristic(optarg);
+
+			if(chosenHeuristic == NULL)
+			{
+				printf("There is no heuristic called %s\n", optarg);
+				return 1;
+			}
+
+			setIdaHeuristic(chosenHeuristic);
+		}
+		else if(option == 'k')
+		{
+			idaPerimeterDepth = atoi(optarg);
+
+			if(idaPerimeterDepth < 0 || idaPerimeterDepth > MAXENDGAMEDEPTH)
+			{
+				printf("The perimeter depth has to be from 0 to %d\n", MAXENDGAMEDEPTH);
+				return 1;
+			}
+		}
+		else if(option == 't')
+		{
+			parallelThreads = atoi(optarg);
+
+			if(parallelThreads < 1 || parallelThreads > MAXTHREADS)
+			{
+				printf("The thread count has to be from 1 to %d\n", MAXTHREADS);
+				return 1;
+			}
+		}
+		else if(option == 'd')
+		{
+			anytimeDeadline = atoi(optarg);
+
+			if(anytimeDeadline < 1)
+			{
+				printf("The deadline has to be at least 1 millisecond\n");
+				return 1;
+			}
+		}
+		else if(option == 'w')
+		{
+			anytimeStartWeight = (int) (atof(optarg) * WEIGHTSCALE + 0.5);
+
+			if(anytimeStartWeight < WEIGHTSCALE || anytimeStartWeight > MAXSTARTWEIGHT)
+			{
+				printf("The weight has to be from 1.0 to %.1f\n", (double) MAXSTARTWEIGHT / WEIGHTSCALE);
+				return 1;
+			}
+		}
+		else if(option == 'D')
+		{
+			searchLimits.maxDepth = atoi(optarg);
+
+			if(searchLimits.maxDepth < 1)
+			{
+				printf("The depth limit has to be at least 1 move\n");
+				return 1;
+			}
+		}
+		else if(option == 'N')
+		{
+			searchLimits.maxNodes = strtoull(optarg, NULL, 10);
+
+			if(searchLimits.maxNodes < 1)
+			{
+				printf("The node limit has to be at least 1 node\n");
+				return 1;
+			}
+		}
+		else if(option == 'M')
+		{
+			searchLimits.maxBytes = (size_t) (atof(optarg) * 1024 * 1024);
+
+			if(searchLimits.maxBytes < 1)
+			{
+				printf("The memory limit has to be more than 0 megabytes\n");
+				return 1;
+			}
+		}
+		else if(option == 'S')
+		{
+			searchLimits.maxSeconds = atof(optarg);
+
+			if(searchLimits.maxSeconds <= 0)
+			{
+				printf("The time limit has to be more than 0 seconds\n");
+				return 1;
+			}
+		}
+		else if(option == 'T')
+		{
+			endgameName = optarg;
+		}
+		else
+		{
+			printf("Usage: %s [-l] [-r] [-e bfs|ida|bidir|perimeter|parallel|pida|astar|pastar|anytime|constructive] [-H %s] [-k depth] [-t threads] [-d milliseconds] [-w weight] [-D depth] [-N nodes] [-M megabytes] [-S seconds] [-T endgameFile]\n", argv[0], heuristicNames());
+			printf("       %s generate 555|663 [fileName]\n", argv[0]);
+			printf("       %s endgame [depth] [fileName]\n", argv[0]);
+			printf("       %s verify 555|663|endgame [fileName]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	if(optind < argc && strcmp(argv[optind], "generate") == 0)
+	{
+		if(optind + 1 >= argc)
+		{
+			printf("Usage: %s generate 555|663 [fileName]\n", argv[0]);
+			return 1;
+		}
+
+		return generateTables(argv[optind + 1], optind + 2 < argc ? argv[optind + 2] : NULL);
+	}
+
+	if(optind < argc && strcmp(argv[optind], "endgame") == 0)
+	{
+		return generateEndgame(optind + 1 < argc ? atoi(argv[optind + 1]) : DEFAULTENDGAMEDEPTH,
+			optind + 2 < argc ? argv[optind + 2] : NULL);
+	}
+
+	if(optind < argc && strcmp(argv[optind], "verify") == 0)
+	{
+		if(optind + 1 >= argc)
+		{
+			printf("Usage: %s verify 555|663|endgame [fileName]\n", argv[0]);
+			return 1;
+		}
+
+		if(strcmp(argv[optind + 1], "endgame") == 0)
+		{
+			return verifyEndgame(optind + 2 < argc ? argv[optind + 2] : NULL);
+		}
+
+		return verifyTables(argv[optind + 1], optind + 2 < argc ? argv[optind + 2] : NULL);
+	}
+
+	endgame.mapping = NULL;
+
+	if(endgameName != NULL)						//the table is only looked in when it is asked for
+	{
+		endgameResult = mapEndgameTable(&endgame, endgameName);
+
+		if(endgameResult != PATTERNFILEOK)
+		{
+			printf("%s %s\n", endgameName, patternFileError(endgameResult));
+			return 1;
+		}
+	}
 
 	printf("Welcome to this 15 puzzle solver\n");
 	printf("Enter an input fileName\n");
@@ -93,14 +620,28 @@ int main(int argc, char *argv[])
 
 	start = clock();
 
-	fillTwoDArray(twoDInputBoard, filePointer);
+	readResult = fillTwoDArray(twoDInputBoard, filePointer);
 
 	fclose(filePointer);
 
+	if(readResult < 0)
+	{
+		printf("That input file does not hold %d rows of %d tiles!\n", BOARDHEIGHT, BOARDWIDTH);
+		printf("Exiting now\n");
+		return 1;
+	}
+
 	blankPositionFromBottom = rowPosition(twoDInputBoard);
 	
 	mapTwoDArrayToOneD(twoDInputBoard, oneDInputBoard);
 
+	if(checkBoard(oneDInputBoard) < 0)
+	{
+		printf("That input file does not hold every tile from 0 to %d once!\n", BOARDSIZE - 1);
+		printf("Exiting now\n");
+		return 1;
+	}
+
 	solvableTest = solvable(blankPositionFromBottom, oneDInputBoard);
 
 	if(solvableTest == 0)
@@ -113,7 +654,12 @@ int main(int argc, char *argv[])
 	{
 		printf("It is solvable!\n");
 		printf("Running test\n");
-		runTest(oneDInputBoard);
+		if(solveFromEndgame(&endgame, oneDInputBoard) == 0)
+		{
+			startSearchLimits();
+			chosenEngine->run(oneDInputBoard);
+		}
+
 		end = clock();
 		timeDiff = end - start;
 		millSeconds = timeDiff * 1000 / CLOCKS_PER_SEC;
@@ -121,5 +667,7 @@ int main(int argc, char *argv[])
 
 		printf("Solving this puzzle took %f seconds\n", seconds);
 	}
+
+	releaseEndgameTable(&endgame);
 	return 0;
 }
@@ -0,0 +1,195 @@
+/*NAME: nodeArena.c
+DATE: Oct 17th 2026
+VERSION: 1.0
+FILENAME: nodeArena.c
+PURPOSE: This module will be an arena for the nodes of a search. A search makes
+	millions of nodes that are all the same size and are all thrown away together
+	once the search is over, so giving each one its own malloc is wasted work, both
+	in the allocator and in the bookkeeping it keeps for every block. Instead, nodes
+	are handed out in order from large chunks and the chunks are freed together when
+	the search is done.
+AUTHOR: Andrew Gendreau
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifndef ARENA_H_
+#define ARENA_H_
+#include "nodeArena.h"
+#endif
+
+#ifndef MEMORY_H_
+#define MEMORY_H_
+#include "memoryTracker.h"
+#endif
+
+/**
+*Name: initializeArena
+*Purpose: This function will, given an arena, a record size and how many
+	records go in each chunk, set the arena up empty. No chunk is allocated
+	until the first record is asked for.
+*Parameters:
+*	arena --arena to initialize
+	recordSize --size of one record in bytes
+	recordsPerChunk --records held by each chunk
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void initializeArena(struct nodeArena *arena, size_t recordSize, unsigned int recordsPerChunk)
+{
+	arena->chunks = NULL;
+	arena->chunkCount = 0;
+	arena->firstLiveChunk = 0;
+	arena->chunkSlots = 0;
+	arena->recordSize = recordSize;
+	arena->recordsPerChunk = recordsPerChunk;
+	arena->recordCount = 0;
+}
+
+/**
+*Name: addChunk
+*Purpose: This function will allocate a new chunk for the arena, doubling
+	the array of chunk pointers first if it is full.
+*Parameters:
+*	arena --arena to add a chunk to
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+static void addChunk(struct nodeArena *arena)
+{
+	unsigned int newSlots;						//size of the chunk array after growing
+
+	if(arena->chunkCount == arena->chunkSlots)
+	{
+		if(arena->chunkSlots == 0)
+		{
+			newSlots = INITIALCHUNKSLOTS;
+		}
+		else
+		{
+			newSlots = arena->chunkSlots * 2;
+		}
+
+		arena->chunks = trackedRealloc(arena->chunks, arena->chunkSlots * sizeof(unsigned char *),
+			newSlots * sizeof(unsigned char *));
+		arena->chunkSlots = newSlots;
+	}
+
+	arena->chunks[arena->chunkCount] = trackedMalloc(arena->recordSize * arena->recordsPerChunk);
+	arena->chunkCount++;
+}
+
+/**
+*Name: arenaAllocate
+*Purpose: This function will hand out the next record of the arena,
+	allocating a new chunk first if the last one is full.
+*Parameters:
+*	arena --arena to take the record from
+*Returns:
+	pointer to the new record, its index is recordCount - 1
+*Author: Andrew Gendreau
+**/
+void *arenaAllocate(struct nodeArena *arena)
+{
+	void *record;							//record to be returned
+
+	if(arena->recordCount == (unsigned long) arena->chunkCount * arena->recordsPerChunk)
+	{
+		addChunk(arena);
+	}
+
+	record = arenaRecord(arena, arena->recordCount);
+	arena->recordCount++;
+
+	return record;
+}
+
+/**
+*Name: arenaRecord
+*Purpose: This function will, given an arena and the index of a record
+	it has handed out, return a pointer to that record.
+*Parameters:
+*	arena --arena the record is in
+	index --index of the record
+*Returns:
+	pointer to the record
+*Author: Andrew Gendreau
+**/
+void *arenaRecord(struct nodeArena *arena, unsigned long index)
+{
+	return arena->chunks[index / arena->recordsPerChunk] + (index % arena->recordsPerChunk) * arena->recordSize;
+}
+
+/**
+*Name: releaseChunksBefore
+*Purpose: This function will, given an arena and a record index, free
+	every chunk that holds only records before that index. Those records
+	can not be used after this, the rest of the arena is untouched.
+*Parameters:
+*	arena --arena to release chunks from
+	index --first record that has to be kept
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void releaseChunksBefore(struct nodeArena *arena, unsigned long index)
+{
+	unsigned int lastChunk;						//chunk holding record index, it has to be kept
+
+	lastChunk = (unsigned int) (index / arena->recordsPerChunk);
+
+	while(arena->firstLiveChunk < lastChunk && arena->firstLiveChunk < arena->chunkCount)
+	{
+		trackedFree(arena->chunks[arena->firstLiveChunk], arena->recordSize * arena->recordsPerChunk);
+		arena->chunks[arena->firstLiveChunk] = NULL;
+		arena->firstLiveChunk++;
+	}
+}
+
+/**
+*Name: releaseArena
+*Purpose: This function will free every chunk of the arena and the chunk
+	array, leaving the arena empty with the same record size.
+*Parameters:
+*	arena --arena to release
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void releaseArena(struct nodeArena *arena)
+{
+	unsigned int i;							//loop control variable
+
+	for(i = arena->firstLiveChunk; i < arena->chunkCount; i++)
+	{
+		trackedFree(arena->chunks[i], arena->recordSize * arena->recordsPerChunk);
+	}
+
+	trackedFree(arena->chunks, arena->chunkSlots * sizeof(unsigned char *));
+
+	initializeArena(arena, arena->recordSize, arena->recordsPerChunk);
+}
+
+/**
+*Name: printArenaStats
+*Purpose: This function will print how many chunks and bytes the arena
+	is holding and how many records it has handed out.
+*Parameters:
+*	arena --arena to report on
+	name --name to print the statistics under
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void printArenaStats(struct nodeArena *arena, char *name)
+{
+	unsigned int liveChunks;					//chunks not yet released
+
+	liveChunks = arena->chunkCount - arena->firstLiveChunk;
+
+	printf("%s arena: %u chunks, %lu bytes, %lu nodes\n", name, liveChunks,
+		(unsigned long) liveChunks * arena->recordsPerChunk * arena->recordSize, arena->recordCount);
+}
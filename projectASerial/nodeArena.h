@@ -0,0 +1,111 @@
+/*NAME: nodeArena.h
+DATE: Oct 17th 2026
+VERSION: 1.0
+FILENAME: nodeArena.h
+PURPOSE: This is a header for nodeArena.c
+AUTHOR: Andrew Gendreau
+*/
+
+#include <stddef.h>
+
+#define NODESPERCHUNK 4096					//records handed out of each chunk before a new one is needed
+#define INITIALCHUNKSLOTS 16					//starting size of the array of chunk pointers
+
+/*
+	This is a struct for an arena of fixed size records. The records live in
+	chunks of recordsPerChunk records each, chunks is an array of pointers to
+	the chunks allocated so far. Records are handed out in order and are never
+	freed one at a time, the whole arena is released at once. Record i is always
+	record i % recordsPerChunk of chunk i / recordsPerChunk, so a record can be
+	found from its index as well as its pointer. The chunks at the front
+	can be released early once none of their records are needed.
+*/
+struct nodeArena
+{
+	unsigned char **chunks;					//the chunks allocated so far
+	unsigned int chunkCount;				//number of chunks in use
+	unsigned int firstLiveChunk;				//chunks before this one have been released
+	unsigned int chunkSlots;				//number of chunk pointers chunks has room for
+	size_t recordSize;					//size of one record in bytes
+	unsigned int recordsPerChunk;				//records held by each chunk
+	unsigned long recordCount;				//records handed out so far
+};
+
+/**
+*Name: initializeArena
+*Purpose: This function will, given an arena, a record size and how many
+	records go in each chunk, set the arena up empty. No chunk is allocated
+	until the first record is asked for.
+*Parameters:
+*	arena --arena to initialize
+	recordSize --size of one record in bytes
+	recordsPerChunk --records held by each chunk
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void initializeArena(struct nodeArena *arena, size_t recordSize, unsigned int recordsPerChunk);
+
+/**
+*Name: arenaAllocate
+*Purpose: This function will hand out the next record of the arena,
+	allocating a new chunk first if the last one is full.
+*Parameters:
+*	arena --arena to take the record from
+*Returns:
+	pointer to the new record, its index is recordCount - 1
+*Author: Andrew Gendreau
+**/
+void *arenaAllocate(struct nodeArena *arena);
+
+/**
+*Name: arenaRecord
+*Purpose: This function will, given an arena and the index of a record
+	it has handed out, return a pointer to that record.
+*Parameters:
+*	arena --arena the record is in
+	index --index of the record
+*Returns:
+	pointer to the record
+*Author: Andrew Gendreau
+**/
+void *arenaRecord(struct nodeArena *arena, unsigned long index);
+
+/**
+*Name: releaseChunksBefore
+*Purpose: This function will, given an arena and a record index, free
+	every chunk that holds only records before that index. Those records
+	can not be used after this, the rest of the arena is untouched.
+*Parameters:
+*	arena --arena to release chunks from
+	index --first record that has to be kept
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void releaseChunksBefore(struct nodeArena *arena, unsigned long index);
+
+/**
+*Name: releaseArena
+*Purpose: This function will free every chunk of the arena and the chunk
+	array, leaving the arena empty with the same record size.
+*Parameters:
+*	arena --arena to release
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void releaseArena(struct nodeArena *arena);
+
+/**
+*Name: printArenaStats
+*Purpose: This function will print how many chunks and bytes the arena
+	is holding and how many records it has handed out.
+*Parameters:
+*	arena --arena to report on
+	name --name to print the statistics under
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void printArenaStats(struct nodeArena *arena, char *name);
@@ -0,0 +1,448 @@
+/*NAME: parallelBfs.c
+DATE: Oct 17th 2026
+VERSION: 1.0
+FILENAME: parallelBfs.c
+PURPOSE: This module will be the parallel breadth first search engine. The
+	forward search expands a level one node at a time on one core. Here every
+	level is still finished before the next is started, but its nodes are handed
+	out FRONTIERCHUNK at a time to parallelThreads worker threads, which expand
+	them at the same time.
+	Each worker puts the children it makes in its own buffer, and the boards
+	seen are kept in a concurrentSet so the workers can check and add them at
+	once without taking a lock. Before each level the set is grown to have room
+	for three children of every node of it, the fourth move is always skipped as
+	it undoes the node's own move, and the root's level fits in any set.
+	Two barriers are shared by the workers and the main thread, one they all
+	wait at before a level is started and one after it is finished. In between
+	the main thread joins the workers' buffers into the next level.
+	A worker that makes the winning board does not stop the others, the level
+	is finished first. Every node of it is the same number of moves from the
+	root, so whichever winning child was made, the path is a shortest one.
+AUTHOR: Andrew Gendreau
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef PARALLELBFS_H_
+#define PARALLELBFS_H_
+#include "parallelBfs.h"
+#endif
+
+#ifndef MEMORY_H_
+#define MEMORY_H_
+#include "memoryTracker.h"
+#endif
+
+#ifndef SEARCHLIMITS_H_
+#define SEARCHLIMITS_H_
+#include "searchLimits.h"
+#endif
+
+int parallelThreads = DEFAULTTHREADS;						//worker threads the search uses
+struct concurrentSet *parallelSeen;						//every board the search has made
+struct bfsLevel parallelLevels[MAXPATHLENGTH + 1];				//every level, by moves from the root
+int parallelDepth;								//level being expanded
+struct bfsWorker parallelWorkers[MAXTHREADS];					//the worker threads
+pthread_barrier_t levelReady;							//waited at before a level is expanded
+pthread_barrier_t levelDone;							//waited at after it has been
+pthread_mutex_t chunkLock = PTHREAD_MUTEX_INITIALIZER;				//held while a chunk is handed out
+unsigned long nextChunk;							//first node of the level not handed out yet
+int parallelDone;								//1 once the workers should exit
+
+/**
+*Name: takeChunk
+*Purpose: This function will hand out the next FRONTIERCHUNK nodes of the
+	current level to whichever worker asks.
+*Parameters:
+*	void
+*Returns:
+	index of the first node of the chunk, the level's count or more once they are all handed out
+*Author: Andrew Gendreau
+**/
+static unsigned long takeChunk(void)
+{
+	unsigned long chunkStart;						//first node of the chunk
+
+	pthread_mutex_lock(&chunkLock);
+	chunkStart = nextChunk;
+	nextChunk = nextChunk + FRONTIERCHUNK;
+	pthread_mutex_unlock(&chunkLock);
+
+	return chunkStart;
+}
+
+/**
+*Name: expandParallelNode
+*Purpose: This function will, given a worker and a node of the current level,
+	make every child but the one that undoes the node's move, and add each one
+	the set had not seen to the end of the worker's buffer. If one of them is
+	the winning board and the worker has no winner yet, it becomes its winner.
+*Parameters:
+*	worker --worker expanding the node
+	nodeIndex --index of the node in the current level
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+static void expandParallelNode(struct bfsWorker *worker, unsigned long nodeIndex)
+{
+	struct searchNode *currentNode;						//node we are expanding
+	struct searchNode *child;						//child being added
+	boardKey childKey;							//key of the board after a move
+	int blankIndex;								//index of the blank on the node's board
+	int backwards;								//direction that would undo the move into the node
+	int i;									//loop control variable
+
+	currentNode = &parallelLevels[parallelDepth].nodes[nodeIndex];
+	blankIndex = currentNode->blankIndex;
+	backwards = (currentNode->direction == (unsigned char) NOMOVE) ? NOMOVE : currentNode->direction ^ 1;
+
+	worker->expanded++;
+
+	for(i = 0; i < movesForBlank[blankIndex]; i++)
+	{
+		if(directionsForBlank[blankIndex][i] == backwards)
+		{
+			continue;
+		}
+
+		childKey = applyMoveToKey(currentNode->key, blankIndex, tilesForBlank[blankIndex][i]);
+
+		if(insertConcurrent(parallelSeen, childKey) > 0)
+		{
+			continue;
+		}
+
+		if(worker->count == worker->size)
+		{
+			worker->buffer = trackedRealloc(worker->buffer, worker->size * sizeof(struct searchNode),
+				worker->size * 2 * sizeof(struct searchNode));
+			worker->size = worker->size * 2;
+		}
+
+		child = &worker->buffer[worker->count];
+		child->key = childKey;
+		child->parent = (unsigned int) nodeIndex;
+		child->direction = (unsigned char) directionsForBlank[blankIndex][i];
+		child->blankIndex = (unsigned char) tilesForBlank[blankIndex][i];
+
+		if(childKey == WINNINGHASH && worker->winner == NOWINNER)
+		{
+			worker->winner = worker->count;
+		}
+
+		worker->count++;
+	}
+}
+
+/**
+*Name: expandWorker
+*Purpose: This function is run by each worker thread. It will wait for a level
+	to be ready, take chunks of it and expand their nodes until there are none
+	left, then wait for the others to finish the level, until the search is done.
+	Each chunk is charged to the search limits, and once one is reached no more
+	chunks are taken.
+*Parameters:
+*	argument --the thread's bfsWorker
+*Returns:
+	NULL
+*Author: Andrew Gendreau
+**/
+static void *expandWorker(void *argument)
+{
+	struct bfsWorker *worker;						//this thread's worker
+	unsigned long levelCount;						//nodes in the current level
+	unsigned long chunkStart;						//first node of the chunk taken
+	unsigned long chunkEnd;							//one past its last node
+	unsigned long i;							//loop control variable
+
+	worker = argument;
+
+	while(1)
+	{
+		pthread_barrier_wait(&levelReady);
+
+		if(parallelDone == 1)
+		{
+			return NULL;
+		}
+
+		levelCount = parallelLevels[parallelDepth].count;
+
+		for(chunkStart = takeChunk(); chunkStart < levelCount; chunkStart = takeChunk())
+		{
+			chunkEnd = chunkStart + FRONTIERCHUNK < levelCount ? chunkStart + FRONTIERCHUNK : levelCount;
+
+			for(i = chunkStart; i < chunkEnd; i++)
+			{
+				expandParallelNode(worker, i);
+			}
+
+			if(chargeSearchLimits(chunkEnd - chunkStart, parallelDepth + 1) != LIMITNONE)
+			{
+				break;
+			}
+		}
+
+		pthread_barrier_wait(&levelDone);
+	}
+}
+
+/**
+*Name: joinLevel
+*Purpose: This function will, once every worker has finished a level, copy
+	their buffers one after the other into the next level and empty them.
+*Parameters:
+*	void
+*Returns:
+	index of the winning node in the new level
+	NOWINNER if no worker made the winning board
+*Author: Andrew Gendreau
+**/
+static unsigned long joinLevel(void)
+{
+	struct bfsLevel *next;							//level being filled
+	unsigned long winner;							//index of the winning node in it
+	unsigned long offset;							//where the next worker's nodes go
+	int t;									//loop control variable
+
+	next = &parallelLevels[parallelDepth + 1];
+	next->count = 0;
+	winner = NOWINNER;
+
+	for(t = 0; t < parallelThreads; t++)
+	{
+		next->count += parallelWorkers[t].count;
+	}
+
+	next->nodes = trackedMalloc((next->count > 0 ? next->count : 1) * sizeof(struct searchNode));
+	offset = 0;
+
+	for(t = 0; t < parallelThreads; t++)
+	{
+		memcpy(&next->nodes[offset], parallelWorkers[t].buffer, parallelWorkers[t].count * sizeof(struct searchNode));
+
+		if(winner == NOWINNER && parallelWorkers[t].winner != NOWINNER)
+		{
+			winner = offset + parallelWorkers[t].winner;
+		}
+
+		offset += parallelWorkers[t].count;
+		parallelWorkers[t].count = 0;
+		parallelWorkers[t].winner = NOWINNER;
+	}
+
+	return winner;
+}
+
+/**
+*Name: traceLevels
+*Purpose: This function will, given the depth and index of the winning node,
+	walk parent indices up the levels to the root and fill path with the moves
+	made from the root to the winner.
+*Parameters:
+*	depth --level the winner is on
+	index --its index in that level
+	path --path to fill
+*Returns:
+	the number of moves on the path
+*Author: Andrew Gendreau
+**/
+static int traceLevels(int depth, unsigned long index, struct movePath *path)
+{
+	struct searchNode *currentNode;						//node we are looking at
+	struct searchNode *parentNode;						//its parent
+	int level;								//level of currentNode
+
+	path->length = depth;
+
+	for(level = depth; level > 0; level--)
+	{
+		currentNode = &parallelLevels[level].nodes[index];
+		parentNode = &parallelLevels[level - 1].nodes[currentNode->parent];
+
+		path->moves[level - 1] = MOVECODE(KEYTILE(currentNode->key, parentNode->blankIndex), currentNode->direction);
+		index = currentNode->parent;
+	}
+
+	return path->length;
+}
+
+/**
+*Name: parallelBfsSolve
+*Purpose: This function will, given a solvable board, find a shortest path to
+	the winning state with a breadth first search whose levels are each expanded
+	by parallelThreads threads at once. It starts the workers, then for every
+	level lets them go, waits for them to finish and joins their buffers into
+	the next level, until a level holds the winning board or is empty. A level
+	a search limit stopped part way is still joined, any winner in it is one.
+*Parameters:
+*	board --1d array containing the game board
+	path --path to fill
+*Returns:
+	the number of moves on the path
+	-1 if there is no path of MAXPATHLENGTH moves or fewer
+	LIMITREACHED if a search limit was reached
+*Author: Andrew Gendreau
+**/
+int parallelBfsSolve(int board[BOARDSIZE], struct movePath *path)
+{
+	boardKey rootKey;							//key of the board we were given
+	unsigned long winner;							//index of the winning node once one is made
+	int length;								//length of the path found
+	int lowerBound;								//fewest moves a path can have, once a limit stops the search
+	int level;								//loop control variable
+	int t;									//loop control variable
+
+	rootKey = encodeBoard(board);
+	path->length = 0;
+
+	if(rootKey == WINNINGHASH)
+	{
+		return 0;
+	}
+
+	parallelSeen = createConcurrentSet(INITIALHASHCAPACITY);
+	insertConcurrent(parallelSeen, rootKey);
+
+	parallelLevels[0].nodes = trackedMalloc(sizeof(struct searchNode));
+	parallelLevels[0].count = 1;
+	parallelLevels[0].nodes[0].key = rootKey;
+	parallelLevels[0].nodes[0].parent = ROOTPARENT;
+	parallelLevels[0].nodes[0].direction = (unsigned char) NOMOVE;
+	parallelLevels[0].nodes[0].blankIndex = (unsigned char) findBlankIndex(board);
+
+	parallelDepth = 0;
+	parallelDone = 0;
+
+	pthread_barrier_init(&levelReady, NULL, parallelThreads + 1);
+	pthread_barrier_init(&levelDone, NULL, parallelThreads + 1);
+
+	for(t = 0; t < parallelThreads; t++)
+	{
+		parallelWorkers[t].size = FRONTIERCHUNK;
+		parallelWorkers[t].buffer = trackedMalloc(parallelWorkers[t].size * sizeof(struct searchNode));
+		parallelWorkers[t].count = 0;
+		parallelWorkers[t].winner = NOWINNER;
+		parallelWorkers[t].expanded = 0;
+		pthread_create(&parallelWorkers[t].thread, NULL, expandWorker, &parallelWorkers[t]);
+	}
+
+	winner = NOWINNER;
+	lowerBound = 0;
+
+	while(winner == NOWINNER && parallelDepth < MAXPATHLENGTH && parallelLevels[parallelDepth].count > 0)
+	{
+		if(chargeSearchLimits(0, parallelDepth + 1) != LIMITNONE)
+		{
+			lowerBound = parallelDepth + 1;
+			break;
+		}
+
+		nextChunk = 0;
+		reserveConcurrent(parallelSeen, parallelLevels[parallelDepth].count * 3);
+
+		pthread_barrier_wait(&levelReady);					//let the workers expand the level
+		pthread_barrier_wait(&levelDone);					//and wait for them to finish it
+
+		winner = joinLevel();
+		parallelDepth++;
+
+		if(atomic_load(&limitHit) != LIMITNONE)
+		{
+			lowerBound = parallelDepth;					//the level may have been stopped part way
+			break;
+		}
+	}
+
+	parallelDone = 1;
+	pthread_barrier_wait(&levelReady);
+
+	for(t = 0; t < parallelThreads; t++)
+	{
+		pthread_join(parallelWorkers[t].thread, NULL);
+		trackedFree(parallelWorkers[t].buffer, parallelWorkers[t].size * sizeof(struct searchNode));
+	}
+
+	pthread_barrier_destroy(&levelReady);
+	pthread_barrier_destroy(&levelDone);
+
+	length = -1;
+
+	if(winner != NOWINNER)
+	{
+		length = traceLevels(parallelDepth, winner, path);
+	}
+	else if(lowerBound > 0)
+	{
+		length = stopAtLimit(lowerBound);
+	}
+
+	for(level = 0; level <= parallelDepth; level++)
+	{
+		trackedFree(parallelLevels[level].nodes,
+			(parallelLevels[level].count > 0 ? parallelLevels[level].count : 1) * sizeof(struct searchNode));
+	}
+
+	destroyConcurrentSet(parallelSeen);
+
+	return length;
+}
+
+/**
+*Name: runParallelBfs
+*Purpose: This function will, given a 1d array that represents the inital board state,
+	solve it with parallelBfsSolve and print the length of the path, its moves,
+	how many nodes were expanded on how many threads and the most heap held at once,
+	or the search limit that stopped it.
+*Parameters:
+	board --1d Int array to hold the root board
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void runParallelBfs(int board[BOARDSIZE])
+{
+	struct movePath winningPath;						//the moves from the root to the goal
+	char winningMoves[PATHTEXTSIZE];					//text of those moves
+	unsigned long long expanded;						//nodes expanded over every thread
+	int length;								//what the solve returned
+	int t;									//loop control variable
+
+	if(encodeBoard(board) == WINNINGHASH)
+	{
+		printf("You gave me a winning state!\n");
+		return;
+	}
+
+	length = parallelBfsSolve(board, &winningPath);
+
+	expanded = 0;
+
+	for(t = 0; t < parallelThreads; t++)
+	{
+		expanded += parallelWorkers[t].expanded;
+	}
+
+	if(length == LIMITREACHED)
+	{
+		reportSearchLimit();
+		printf("Expanded %llu nodes on %d threads\n", expanded, parallelThreads);
+		return;
+	}
+
+	if(length < 0)
+	{
+		printf("There is no solution in %d moves or fewer\n", MAXPATHLENGTH);
+		return;
+	}
+
+	formatMovePath(&winningPath, winningMoves);
+
+	printf("It took %d moves\n", winningPath.length);
+	printf("The moves were: %s\n", winningMoves);
+	printf("Expanded %llu nodes on %d threads\n", expanded, parallelThreads);
+	printf("Peak heap use was %lu bytes\n", (unsigned long) memoryUsage.peakBytes);
+}
@@ -0,0 +1,79 @@
+/*NAME: parallelBfs.h
+DATE: Oct 17th 2026
+VERSION: 1.0
+FILENAME: parallelBfs.h
+PURPOSE: This is a header for parallelBfs.c
+AUTHOR: Andrew Gendreau
+*/
+
+#include <pthread.h>
+
+#ifndef SEARCHTREE_H_
+#define SEARCHTREE_H_
+#include "searchTree.h"
+#endif
+
+#ifndef CONCURRENTSET_H_
+#define CONCURRENTSET_H_
+#include "concurrentSet.h"
+#endif
+
+#define DEFAULTTHREADS 4					//worker threads if -t is not given
+#define MAXTHREADS 64						//most worker threads -t takes
+#define FRONTIERCHUNK 1024					//nodes of the current level a worker takes at a time
+
+/*
+	This is a struct for one level of the parallel search, all of its nodes in
+	one array. The parent of a node is its index in the level before.
+*/
+struct bfsLevel
+{
+	struct searchNode *nodes;				//the nodes
+	unsigned long count;					//number of nodes
+};
+
+/*
+	This is a struct for one worker thread. It keeps the children it makes
+	during a level in its own buffer, so no thread waits on another to add a node.
+*/
+struct bfsWorker
+{
+	pthread_t thread;					//the thread
+	struct searchNode *buffer;				//children made this level
+	unsigned long count;					//number of them
+	unsigned long size;					//number there is room for
+	unsigned long winner;					//index of the winning child in buffer, NOWINNER if none
+	unsigned long long expanded;				//nodes this thread has expanded
+};
+
+#define NOWINNER 0xFFFFFFFFFFFFFFFFUL				//winner of a worker that has not made the goal
+
+/**
+*Name: parallelBfsSolve
+*Purpose: This function will, given a solvable board, find a shortest path to
+	the winning state with a breadth first search whose levels are each expanded
+	by parallelThreads threads at once.
+*Parameters:
+*	board --1d array containing the game board
+	path --path to fill
+*Returns:
+	the number of moves on the path
+	-1 if there is no path of MAXPATHLENGTH moves or fewer
+	LIMITREACHED if a search limit was reached
+*Author: Andrew Gendreau
+**/
+int parallelBfsSolve(int board[BOARDSIZE], struct movePath *path);
+
+/**
+*Name: runParallelBfs
+*Purpose: This function will, given a 1d array that represents the inital board state,
+	solve it with parallelBfsSolve and print the length of the path, its moves,
+	how many nodes were expanded on how many threads and the most heap held at once,
+	or the search limit that stopped it.
+*Parameters:
+	board --1d Int array to hold the root board
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void runParallelBfs(int board[BOARDSIZE]);
@@ -0,0 +1,459 @@
+/*NAME: parallelIda.c
+DATE: Oct 17th 2026
+VERSION: 1.0
+FILENAME: parallelIda.c
+PURPOSE: This module will be the parallel iterative deepening A* engine. Every
+	pass of iterative deepening A* with a given bound searches the same tree,
+	and the subtrees under different boards of it never share anything but the
+	bound, so they can be searched by different threads at once.
+	Each pass starts by expanding the root, a level at a time and pruning on the
+	bound the same way the search does, until there are TASKSPERTHREAD boards
+	for every thread. Those boards are dealt out to one deque per thread, and
+	each thread runs boundedSearch under them one after another. A thread whose
+	deque is empty steals from the front of another's, picked at random, so no
+	thread sits idle while another still has a backlog of subtrees.
+	The smallest total over the bound is kept in one atomic int that every
+	thread lowers with a compare and swap, so it is the next pass's bound once
+	the threads are joined. The first thread to reach the goal sets an atomic
+	stop flag that every search checks before each expansion. Any path found
+	under the bound of a pass is a shortest one, since the pass before found
+	none, so the rest of the pass can be dropped.
+AUTHOR: Andrew Gendreau
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef PARALLELIDA_H_
+#define PARALLELIDA_H_
+#include "parallelIda.h"
+#endif
+
+#ifndef SEARCHLIMITS_H_
+#define SEARCHLIMITS_H_
+#include "searchLimits.h"
+#endif
+
+/*
+	This is a struct for one thread of the parallel search.
+*/
+struct idaWorker
+{
+	pthread_t thread;						//the thread
+	int index;							//which thread it is, and which deque it owns
+	unsigned int seed;						//random state for picking who to steal from
+	unsigned long long steals;					//subtrees it has stolen
+	struct idaSearch search;					//the search it runs under each subtree
+};
+
+extern int parallelThreads;						//threads the parallel searches use
+extern struct heuristic *idaHeuristic;					//lower bound the searches use
+
+struct idaTask passTasks[2][MAXIDATASKS];				//the subtrees of the current pass, and the level being made
+int passTaskCount;							//subtrees in passTasks[passTaskLevel]
+int passTaskLevel;							//which of the two passTasks holds the pass's subtrees
+int passBound;								//bound of the current pass
+atomic_int passNextBound;						//smallest total over passBound seen in the pass
+atomic_int idaStop;							//set once a thread has reached the goal
+struct movePath parallelIdaPath;					//path the first thread to reach the goal found
+struct taskDeque taskDeques[MAXTHREADS];				//the subtrees each thread has left
+struct idaWorker idaWorkers[MAXTHREADS];				//the threads
+unsigned long long splitNodesExpanded;					//nodes expanded splitting the passes
+
+/**
+*Name: lowerNextBound
+*Purpose: This function will, given a total over the bound, make it the next
+	bound if it is smaller than the one there, from any thread.
+*Parameters:
+*	candidate --total to try
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+static void lowerNextBound(int candidate)
+{
+	int current;								//next bound as this thread last saw it
+
+	current = atomic_load(&passNextBound);
+
+	while(candidate < current && !atomic_compare_exchange_weak(&passNextBound, &current, candidate))
+	{
+		//a failed swap has put the value there now in current, try again against it
+	}
+}
+
+/**
+*Name: splitPass
+*Purpose: This function will, given the root of the search, expand it a level
+	at a time into passTasks, leaving out the move that undoes each board's own
+	and any child whose total is over passBound, until there are TASKSPERTHREAD
+	subtrees for every thread, another level would not fit, or a subtree is the
+	goal. A child left out lowers the next bound the same way a search would.
+*Parameters:
+*	root --task for the root board
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+static void splitPass(struct idaTask *root)
+{
+	struct idaTask *parent;							//subtree being expanded
+	struct idaTask *child;							//child being made
+	int from;								//passTasks level being expanded
+	int to;									//passTasks level being made
+	int childCount;								//children made so far
+	int goalFound;								//1 if a subtree is the goal
+	int tileIndex;								//index of the tile being moved
+	int tile;								//the tile
+	int direction;								//direction it moves
+	int t;									//loop control variable
+	int i;									//loop control variable
+
+	memcpy(&passTasks[0][0], root, sizeof(struct idaTask));
+	passTaskCount = 1;
+	passTaskLevel = 0;
+	goalFound = (root->key == WINNINGHASH);
+
+	while(goalFound == 0 && passTaskCount > 0 && passTaskCount < TASKSPERTHREAD * parallelThreads
+		&& passTaskCount * 3 + 1 <= MAXIDATASKS && passTasks[passTaskLevel][0].moves < MAXPATHLENGTH)
+	{
+		from = passTaskLevel;
+		to = 1 - passTaskLevel;
+		childCount = 0;
+
+		for(t = 0; t < passTaskCount; t++)
+		{
+			parent = &passTasks[from][t];
+			splitNodesExpanded++;
+
+			for(i = 0; i < movesForBlank[parent->blank]; i++)
+			{
+				direction = directionsForBlank[parent->blank][i];
+
+				if(parent->lastDirection != NOMOVE && direction == (parent->lastDirection ^ 1))
+				{
+					continue;
+				}
+
+				tileIndex = tilesForBlank[parent->blank][i];
+				tile = parent->board[tileIndex];
+
+				child = &passTasks[to][childCount];
+				memcpy(child->board, parent->board, sizeof(child->board));
+				child->board[parent->blank] = tile;
+				child->board[tileIndex] = 0;
+				child->blank = tileIndex;
+				child->key = applyMoveToKey(parent->key, parent->blank, tileIndex);
+				child->moves = parent->moves + 1;
+				child->lastDirection = direction;
+				memcpy(child->prefix, parent->prefix, parent->moves);
+				child->prefix[parent->moves] = MOVECODE(tile, direction);
+				idaHeuristic->update(&parent->state, &child->state, child->board, tile, tileIndex, parent->blank);
+
+				if(child->moves + child->state.value > passBound)
+				{
+					lowerNextBound(child->moves + child->state.value);
+					continue;
+				}
+
+				if(child->key == WINNINGHASH)
+				{
+					goalFound = 1;
+				}
+
+				childCount++;
+			}
+		}
+
+		passTaskLevel = to;
+		passTaskCount = childCount;
+	}
+}
+
+/**
+*Name: takeTask
+*Purpose: This function will, given a thread, take the subtree at the back of
+	its own deque, or if it has none, steal the one at the front of another
+	thread's. It tries parallelThreads random threads first and then every
+	thread in turn, and only gives up once every deque is empty.
+*Parameters:
+*	worker --thread that wants a subtree
+*Returns:
+	index of the subtree in passTasks[passTaskLevel]
+	-1 if there are none left anywhere
+*Author: Andrew Gendreau
+**/
+static int takeTask(struct idaWorker *worker)
+{
+	struct taskDeque *deque;						//deque being taken from
+	int task;								//subtree taken
+	int victim;								//thread being stolen from
+	int attempt;								//loop control variable
+
+	task = -1;
+	deque = &taskDeques[worker->index];
+
+	pthread_mutex_lock(&deque->lock);
+
+	if(deque->back > deque->front)
+	{
+		deque->back--;
+		task = deque->tasks[deque->back];
+	}
+
+	pthread_mutex_unlock(&deque->lock);
+
+	for(attempt = 0; task < 0 && attempt < 2 * parallelThreads; attempt++)
+	{
+		if(attempt < parallelThreads)
+		{
+			victim = rand_r(&worker->seed) % parallelThreads;
+		}
+		else
+		{
+			victim = attempt - parallelThreads;
+		}
+
+		if(victim == worker->index)
+		{
+			continue;
+		}
+
+		deque = &taskDeques[victim];
+
+		pthread_mutex_lock(&deque->lock);
+
+		if(deque->back > deque->front)
+		{
+			task = deque->tasks[deque->front];
+			deque->front++;
+			worker->steals++;
+		}
+
+		pthread_mutex_unlock(&deque->lock);
+	}
+
+	return task;
+}
+
+/**
+*Name: idaWorkerThread
+*Purpose: This function is run by each thread for a pass. It will take subtrees
+	until there are none left or another thread has reached the goal, and run
+	boundedSearch under each one. If it reaches the goal first it sets idaStop
+	and copies its path out.
+*Parameters:
+*	argument --the thread's idaWorker
+*Returns:
+	NULL
+*Author: Andrew Gendreau
+**/
+static void *idaWorkerThread(void *argument)
+{
+	struct idaWorker *worker;						//this thread
+	struct idaTask *task;							//subtree being searched
+	int taskIndex;								//its index
+	int result;								//what the search under it returned
+	int expected;								//idaStop before this thread set it
+
+	worker = argument;
+
+	while(atomic_load_explicit(&idaStop, memory_order_relaxed) == 0 && (taskIndex = takeTask(worker)) >= 0)
+	{
+		task = &passTasks[passTaskLevel][taskIndex];
+
+		memcpy(worker->search.board, task->board, sizeof(task->board));
+		worker->search.blank = task->blank;
+		worker->search.key = task->key;
+		memcpy(worker->search.path.moves, task->prefix, task->moves);
+		memcpy(&worker->search.states[task->moves], &task->state, sizeof(struct heuristicState));
+
+		result = boundedSearch(&worker->search, task->moves, passBound, task->lastDirection);
+
+		if(result == FOUNDSOLUTION)
+		{
+			expected = 0;
+
+			if(atomic_compare_exchange_strong(&idaStop, &expected, 1))
+			{
+				memcpy(&parallelIdaPath, &worker->search.path, sizeof(struct movePath));
+			}
+
+			break;
+		}
+
+		lowerNextBound(result);
+	}
+
+	return NULL;
+}
+
+/**
+*Name: parallelIdaSolve
+*Purpose: This function will, given a solvable board, find a shortest path to
+	the winning state with iterative deepening A*, splitting every pass into
+	subtrees that parallelThreads threads search at once. Each pass is split,
+	dealt out round robin to the deques, searched by the threads until they
+	run out or one reaches the goal, and if none did the next pass starts at
+	the smallest total over the bound any of them saw. A search limit reached
+	by any thread stops them all through idaStop.
+*Parameters:
+*	board --1d array containing the game board
+	path --path to fill
+*Returns:
+	the number of moves on the path
+	-1 if there is no path of MAXPATHLENGTH moves or fewer
+	LIMITREACHED if a search limit was reached
+*Author: Andrew Gendreau
+**/
+int parallelIdaSolve(int board[BOARDSIZE], struct movePath *path)
+{
+	static struct idaTask root;						//the root board as a subtree
+	int found;								//1 once a thread has reached the goal, STOPPEDATLIMIT if a limit was
+	int bound;								//bound of the last pass run
+	int t;									//loop control variable
+	int i;									//loop control variable
+
+	if(idaHeuristic == NULL)
+	{
+		idaHeuristic = findHeuristic("manhattan");
+	}
+
+	memcpy(root.board, board, sizeof(root.board));
+	root.blank = findBlankIndex(root.board);
+	root.key = encodeBoard(root.board);
+	root.moves = 0;
+	root.lastDirection = NOMOVE;
+	idaHeuristic->evaluate(root.board, &root.state);
+
+	for(t = 0; t < parallelThreads; t++)
+	{
+		idaWorkers[t].index = t;
+		idaWorkers[t].seed = (unsigned int) t * 2654435761U + 1;
+		idaWorkers[t].steals = 0;
+		idaWorkers[t].search.nodesExpanded = 0;
+		idaWorkers[t].search.stop = &idaStop;
+		pthread_mutex_init(&taskDeques[t].lock, NULL);
+	}
+
+	splitNodesExpanded = 0;
+	passBound = root.state.value;
+	found = 0;
+
+	bound = passBound;
+
+	while(found == 0 && passBound <= MAXPATHLENGTH)
+	{
+		bound = passBound;
+
+		if(chargeSearchLimits(0, bound) != LIMITNONE)
+		{
+			found = STOPPEDATLIMIT;
+			break;
+		}
+
+		atomic_store(&passNextBound, NOBOUND);
+		atomic_store(&idaStop, 0);
+
+		splitPass(&root);
+
+		for(t = 0; t < parallelThreads; t++)
+		{
+			taskDeques[t].front = 0;
+			taskDeques[t].back = 0;
+		}
+
+		for(i = 0; i < passTaskCount; i++)
+		{
+			t = i % parallelThreads;
+			taskDeques[t].tasks[taskDeques[t].back] = i;
+			taskDeques[t].back++;
+		}
+
+		for(t = 0; t < parallelThreads; t++)
+		{
+			pthread_create(&idaWorkers[t].thread, NULL, idaWorkerThread, &idaWorkers[t]);
+		}
+
+		for(t = 0; t < parallelThreads; t++)
+		{
+			pthread_join(idaWorkers[t].thread, NULL);
+		}
+
+		found = atomic_load(&idaStop);
+		passBound = atomic_load(&passNextBound);
+	}
+
+	for(t = 0; t < parallelThreads; t++)
+	{
+		pthread_mutex_destroy(&taskDeques[t].lock);
+	}
+
+	if(found == 0)
+	{
+		path->length = 0;
+		return -1;
+	}
+
+	if(found == STOPPEDATLIMIT)
+	{
+		path->length = 0;
+		return stopAtLimit(bound);
+	}
+
+	memcpy(path, &parallelIdaPath, sizeof(struct movePath));
+	return path->length;
+}
+
+/**
+*Name: runParallelIda
+*Purpose: This function will, given a 1d array that represents the inital board state,
+	solve it with parallelIdaSolve and print the length of the path, its moves, how
+	many nodes were expanded on how many threads and how many subtrees were stolen,
+	or the search limit that stopped it.
+*Parameters:
+	board --1d Int array to hold the root board
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void runParallelIda(int board[BOARDSIZE])
+{
+	struct movePath winningPath;						//the moves from the root to the goal
+	char winningMoves[PATHTEXTSIZE];					//text of those moves
+	unsigned long long expanded;						//nodes expanded over every thread
+	unsigned long long steals;						//subtrees stolen over every thread
+	int length;								//what the solve returned
+	int t;									//loop control variable
+
+	length = parallelIdaSolve(board, &winningPath);
+
+	expanded = splitNodesExpanded;
+	steals = 0;
+
+	for(t = 0; t < parallelThreads; t++)
+	{
+		expanded += idaWorkers[t].search.nodesExpanded;
+		steals += idaWorkers[t].steals;
+	}
+
+	if(length == LIMITREACHED)
+	{
+		reportSearchLimit();
+		printf("Expanded %llu nodes on %d threads\n", expanded, parallelThreads);
+		return;
+	}
+
+	if(length < 0)
+	{
+		printf("There is no solution in %d moves or fewer\n", MAXPATHLENGTH);
+		return;
+	}
+
+	formatMovePath(&winningPath, winningMoves);
+
+	printf("It took %d moves\n", winningPath.length);
+	printf("The moves were: %s\n", winningMoves);
+	printf("Expanded %llu nodes on %d threads, %llu subtrees were stolen\n", expanded, parallelThreads, steals);
+}
@@ -0,0 +1,79 @@
+/*NAME: parallelIda.h
+DATE: Oct 17th 2026
+VERSION: 1.0
+FILENAME: parallelIda.h
+PURPOSE: This is a header for parallelIda.c
+AUTHOR: Andrew Gendreau
+*/
+
+#include <pthread.h>
+
+#ifndef IDASTAR_H_
+#define IDASTAR_H_
+#include "idaStar.h"
+#endif
+
+#ifndef PARALLELBFS_H_
+#define PARALLELBFS_H_
+#include "parallelBfs.h"
+#endif
+
+#define TASKSPERTHREAD 16					//subtrees each thread should have to start a pass with
+#define MAXIDATASKS (TASKSPERTHREAD * MAXTHREADS * 4)		//most subtrees one pass is split into
+
+/*
+	This is a struct for one subtree of a pass, the board at its root, the
+	moves from the search's root to it and that board's lower bound.
+*/
+struct idaTask
+{
+	int board[BOARDSIZE];					//board at the root of the subtree
+	int blank;						//1d index of its blank
+	boardKey key;						//its key
+	int moves;						//moves from the search's root to it
+	int lastDirection;					//direction of the last of them
+	moveCode prefix[MAXPATHLENGTH];				//the moves
+	struct heuristicState state;				//its lower bound
+};
+
+/*
+	This is a struct for the deque of subtrees one thread owns. The thread
+	takes from the back, and a thread with none left steals from the front.
+*/
+struct taskDeque
+{
+	int tasks[MAXIDATASKS];					//indexes into the pass's tasks
+	int front;						//first task still here
+	int back;						//one past the last
+	pthread_mutex_t lock;					//held while a task is taken
+};
+
+/**
+*Name: parallelIdaSolve
+*Purpose: This function will, given a solvable board, find a shortest path to
+	the winning state with iterative deepening A*, splitting every pass into
+	subtrees that parallelThreads threads search at once.
+*Parameters:
+*	board --1d array containing the game board
+	path --path to fill
+*Returns:
+	the number of moves on the path
+	-1 if there is no path of MAXPATHLENGTH moves or fewer
+	LIMITREACHED if a search limit was reached
+*Author: Andrew Gendreau
+**/
+int parallelIdaSolve(int board[BOARDSIZE], struct movePath *path);
+
+/**
+*Name: runParallelIda
+*Purpose: This function will, given a 1d array that represents the inital board state,
+	solve it with parallelIdaSolve and print the length of the path, its moves, how
+	many nodes were expanded on how many threads and how many subtrees were stolen,
+	or the search limit that stopped it.
+*Parameters:
+	board --1d Int array to hold the root board
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void runParallelIda(int board[BOARDSIZE]);
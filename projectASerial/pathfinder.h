@@ -1,6 +1,6 @@
 /*NAME: pathfinder.h
 DATE: Oct 14th 2016
-VERSION: 2.0
+VERSION: 3.0
 FILENAME: hashList.h
 PURPOSE: This is the header file for pathfinder.c
 AUTHOR: Andrew Gendreau
@@ -9,6 +9,24 @@ AUTHOR: Andrew Gendreau
 #define BOARDWIDTH 4
 #define BOARDHEIGHT 4
 #define BOARDSIZE 16							//the size of the board, 4x4, so 16 elements total.
+#define MAXMOVES 4							//most tiles that can ever move into the blank
+
+#define MOVEUP 0							//direction codes for the direction a tile moves,
+#define MOVEDOWN 1							//a code xor 1 is the opposite direction
+#define MOVELEFT 2
+#define MOVERIGHT 3
+#define NOMOVE -1							//filler for the unused entries of the move tables
+#define DIRECTIONLETTERS "UDLR"						//letter for each direction code, used in the move strings
+
+/*
+* The move tables. For every 1d index the blank can be at, movesForBlank holds
+* how many tiles can move into it, tilesForBlank holds the 1d indexes of those tiles
+* and directionsForBlank the direction code each of them moves in. Only the first
+* movesForBlank[blankIndex] entries of a row are used, the rest are NOMOVE.
+*/
+extern const int movesForBlank[BOARDSIZE];
+extern const int tilesForBlank[BOARDSIZE][MAXMOVES];
+extern const int directionsForBlank[BOARDSIZE][MAXMOVES];
 
 /**
 *Name: findBlankIndex
@@ -52,65 +70,6 @@ int findX(int OneDblankIndex);
 **/
 int findY(int OneDblankIndex);
 
-/**
-*Name: numberofMovesPossible
-*Purpose: This function will, given the x and y coordinate of the blank,
-	compute the number of moves possible. It will do this by using a switch,
-	using the following heuristic:
-		We will start assuming 4 moves are possible, if either the x or y
-		coordinate is 0 or 3, we cannot make at least one move in that dimension.
-		This assumes that we can make at least 2 moves, which we always should be
-		able to, the worst case is when the blank is in a corner, in which case we have
-		2 moves.
-*Parameters: 
-	blankX --x coordinate of the blank
-	blankY --y coordinate of the blank
-*Returns:
-	the number of moves possible
-*Author: Andrew Gendreau
-**/
-int numberofMovesPossible(int blankX, int blankY);
-
-/**
-*Name: findMoveDirections
-*Purpose: This function will, given the number of moves possible,
-	the x and y coordinates of the blank, find the 
-	directions tiles can move to trade positions with the blank.
-	It will represent the directions as a char array, using the following
-	representation:
-		U -UP -tile can move up
-		R -Right -tile can move right
-		L -Left	-tile can move left
-		D -Down	-tile can move down
-*Parameters: 
-	movesPossible --number of moves possible
-	blankX --x coordinate of the blank
-	blankY --y coordinate of the blank
-*Returns:
-	char array representing the possible directions
-*Author: Andrew Gendreau
-**/
-char *findMoveDirections(int movesPossible, int blankX, int blankY);
-
-/**
-*Name: tilesToMoveIn
-*Purpose: This function will, given the number of moves possible,
-	the x and y coordinates of the blank, and the move directions,
-	find the 1D array indexes of the tiles that can move in.
-	it will compute the 1d array index as follows:
-		1d array index: Y * 4 + X
-		This gives us the 1d mapping of a given 2d coordinate.
-*Parameters: 
-	moveDirections --directions tiles can move in from
-	movesPossible --number of moves possible
-	blankX --x coordinate of the blank
-	blankY --y coordinate of the blank
-*Returns:
-	int array representing the indexes of the tiles that can be moved in
-*Author: Andrew Gendreau
-**/
-int *tilesToMoveIn(int movesPossible, int blankX, int blankY, char *moveDirections);
-
 /**
 *Name: swap
 *Purpose: This function will, given the 1d index of the blank,
@@ -0,0 +1,399 @@
+/*NAME: patternDatabase.c
+DATE: Oct 17th 2026
+VERSION: 1.0
+FILENAME: patternDatabase.c
+PURPOSE: This module will build the additive disjoint pattern databases. The tiles
+	are split into groups, and for each group a table is made of the fewest moves
+	of the group's tiles it takes to get them home from every place they can be,
+	with the other tiles treated as blanks. Those tables are made by a breadth first
+	search backwards from the goal over abstract states, where a state is the places
+	of the group's tiles and of the blank. Moving the blank onto a cell the group
+	does not hold costs nothing and moving it onto one of the group's tiles costs a
+	move, so the search takes every free move out of a state before any that cost
+	one, and the first time a placement of the tiles is reached is its distance.
+	The blank's place is only kept while searching, the table is indexed by the
+	rank of the tiles' places alone and holds one byte per entry.
+	Partitions:
+		555 --{1 2 3 5 6} {4 7 8 11 12} {9 10 13 14 15}, three tables of 524160 entries
+		663 --{1 2 3 4 5 9} {6 7 8 10 11 12} {13 14 15}, two of 5765760 and one of 3360
+AUTHOR: Andrew Gendreau
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+
+#ifndef PATTERNDB_H_
+#define PATTERNDB_H_
+#include "patternDatabase.h"
+#endif
+
+#ifndef MEMORY_H_
+#define MEMORY_H_
+#include "memoryTracker.h"
+#endif
+
+#define STATESHIFT(tile) (4 * ((tile) + 1))				//where a tile's place is packed in a generation state
+#define INITIALSTATELIST 4096						//starting size of a generation level
+
+struct partition partitions[] =						//every partition, by name
+{
+	{"555", 3, {{5, {1, 2, 3, 5, 6}}, {5, {4, 7, 8, 11, 12}}, {5, {9, 10, 13, 14, 15}}}},
+	{"663", 3, {{6, {1, 2, 3, 4, 5, 9}}, {6, {6, 7, 8, 10, 11, 12}}, {3, {13, 14, 15}}}}
+};
+
+#define PARTITIONCOUNT (int) (sizeof(partitions) / sizeof(partitions[0]))
+
+const int reflectedIndex[BOARDSIZE] = {0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15};
+const int reflectedTile[BOARDSIZE] = {0, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15, 4, 8, 12};
+
+/**
+*Name: findPartition
+*Purpose: This function will, given the name of a partition, return it.
+	Its tables are not built until buildPartition is called.
+*Parameters:
+*	name --555 or 663
+*Returns:
+	pointer to the partition
+	NULL if there is none with that name
+*Author: Andrew Gendreau
+**/
+struct partition *findPartition(char *name)
+{
+	int i;									//loop control variable
+
+	for(i = 0; i < PARTITIONCOUNT; i++)
+	{
+		if(strcmp(name, partitions[i].name) == 0)
+		{
+			return &partitions[i];
+		}
+	}
+
+	return NULL;
+}
+
+/**
+*Name: rankPattern
+*Purpose: This function will, given the indexes the tiles of a group are at,
+	in the group's order, turn them into a number from 0 up to the group's
+	entries. The first tile has 16 places it can be, the next 15, and so on,
+	so each index is counted among the places still free.
+*Parameters:
+*	positions --1d index of each tile of the group
+	tileCount --number of tiles in the group
+*Returns:
+	the rank
+*Author: Andrew Gendreau
+**/
+unsigned long rankPattern(int positions[], int tileCount)
+{
+	unsigned long rank;							//rank so far
+	unsigned int used;							//bit i set once index i is taken
+	int i;									//loop control variable
+
+	rank = 0;
+	used = 0;
+
+	for(i = 0; i < tileCount; i++)
+	{
+		rank = rank * (BOARDSIZE - i) + (positions[i] - __builtin_popcount(used & ((1U << positions[i]) - 1)));
+		used |= 1U << positions[i];
+	}
+
+	return rank;
+}
+
+/**
+*Name: groupRank
+*Purpose: This function will, given a group and where every tile is,
+	return the rank of the group's tiles.
+*Parameters:
+*	group --group to rank
+	where --1d index of every tile, by tile
+*Returns:
+	the rank
+*Author: Andrew Gendreau
+**/
+unsigned long groupRank(struct patternGroup *group, int where[BOARDSIZE])
+{
+	int positions[MAXPATTERNTILES];						//places of the group's tiles
+	int i;									//loop control variable
+
+	for(i = 0; i < group->tileCount; i++)
+	{
+		positions[i] = where[group->tiles[i]];
+	}
+
+	return rankPattern(positions, group->tileCount);
+}
+
+/**
+*Name: reflectedGroupRank
+*Purpose: This function will, given a group and where every tile is, return
+	the rank of the group's tiles on the board reflected about its main
+	diagonal. Tile t of the reflected board is where reflectedTile[t] is on
+	the board, moved to the reflection of that index.
+*Parameters:
+*	group --group to rank
+	where --1d index of every tile on the board, by tile
+*Returns:
+	the rank
+*Author: Andrew Gendreau
+**/
+unsigned long reflectedGroupRank(struct patternGroup *group, int where[BOARDSIZE])
+{
+	int positions[MAXPATTERNTILES];						//places of the group's tiles on the reflected board
+	int i;									//loop control variable
+
+	for(i = 0; i < group->tileCount; i++)
+	{
+		positions[i] = reflectedIndex[where[reflectedTile[group->tiles[i]]]];
+	}
+
+	return rankPattern(positions, group->tileCount);
+}
+
+/**
+*Name: appendState
+*Purpose: This function will add a generation state to the end of a level,
+	doubling the level first if it is full.
+*Parameters:
+*	level --pointer to the level's array
+	count --pointer to the number of states in it
+	size --pointer to the number it has room for
+	state --state to add
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+static void appendState(unsigned int **level, unsigned long *count, unsigned long *size, unsigned int state)
+{
+	if(*count == *size)
+	{
+		*level = trackedRealloc(*level, *size * sizeof(unsigned int), *size * 2 * sizeof(unsigned int));
+		*size = *size * 2;
+	}
+
+	(*level)[*count] = state;
+	(*count)++;
+}
+
+/**
+*Name: generateGroup
+*Purpose: This function will fill a group's table. A generation state packs
+	the blank's index in its bottom 4 bits and the index of tile i of the
+	group in the 4 bits above that, and costs holds the fewest moves found
+	to every state, by rank * 16 + blank. The search goes one cost at a time,
+	a state whose blank moves onto a free cell goes on the end of the level
+	being searched and one whose blank moves onto a tile goes into the next.
+	A state is only added when its cost goes down, and one that was lowered
+	after it was added to the next level is skipped when it is reached there.
+*Parameters:
+*	group --group to generate
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+static void generateGroup(struct patternGroup *group)
+{
+	unsigned char *costs;							//fewest moves to each state, PATTERNUNSEEN if not reached
+	unsigned int *current;							//states of the cost being searched
+	unsigned int *next;							//states of the cost after it
+	unsigned int *swapLevel;						//used to swap the levels
+	unsigned long currentCount;						//states in current
+	unsigned long currentSize;						//states current has room for
+	unsigned long nextCount;						//states in next
+	unsigned long nextSize;							//states next has room for
+	unsigned long i;							//state of current being expanded
+	unsigned long rank;							//rank of the tiles of that state
+	unsigned long childRank;						//rank after a tile moves
+	unsigned int state;							//the state being expanded
+	unsigned int childState;						//state after a move
+	int positions[MAXPATTERNTILES];						//places of the group's tiles
+	int tileAt[BOARDSIZE];							//tile of the group at each index, NOGROUP if none
+	int blankIndex;								//index of the blank
+	int cell;								//index the blank moves to
+	int tile;								//tile of the group the blank moves onto
+	int cost;								//cost being searched
+	int m;									//move being made
+	int t;									//loop control variable
+
+	group->entries = 1;
+	for(t = 0; t < group->tileCount; t++)
+	{
+		group->entries = group->entries * (BOARDSIZE - t);
+	}
+
+	group->distances = trackedMalloc(group->entries);
+	memset(group->distances, PATTERNUNSEEN, group->entries);
+	costs = trackedMalloc(group->entries * BOARDSIZE);
+	memset(costs, PATTERNUNSEEN, group->entries * BOARDSIZE);
+
+	currentSize = INITIALSTATELIST;
+	current = trackedMalloc(currentSize * sizeof(unsigned int));
+	nextSize = INITIALSTATELIST;
+	next = trackedMalloc(nextSize * sizeof(unsigned int));
+
+	state = BOARDSIZE - 1;							//the goal, the blank in the last cell
+	for(t = 0; t < group->tileCount; t++)
+	{
+		positions[t] = group->tiles[t] - 1;
+		state |= (unsigned int) positions[t] << STATESHIFT(t);
+	}
+
+	costs[rankPattern(positions, group->tileCount) * BOARDSIZE + BOARDSIZE - 1] = 0;
+	currentCount = 0;
+	nextCount = 0;
+	appendState(&current, &currentCount, &currentSize, state);
+	cost = 0;
+
+	while(currentCount > 0)
+	{
+		for(i = 0; i < currentCount; i++)				//currentCount grows as free moves are added
+		{
+			state = current[i];
+			blankIndex = (int) (state & 0xF);
+
+			for(cell = 0; cell < BOARDSIZE; cell++)
+			{
+				tileAt[cell] = NOGROUP;
+			}
+
+			for(t = 0; t < group->tileCount; t++)
+			{
+				positions[t] = (int) ((state >> STATESHIFT(t)) & 0xF);
+				tileAt[positions[t]] = t;
+			}
+
+			rank = rankPattern(positions, group->tileCount);
+
+			if(costs[rank * BOARDSIZE + blankIndex] != cost)	//it was lowered after it was added
+			{
+				continue;
+			}
+
+			if(group->distances[rank] == PATTERNUNSEEN)
+			{
+				group->distances[rank] = (unsigned char) cost;
+			}
+
+			for(m = 0; m < movesForBlank[blankIndex]; m++)
+			{
+				cell = tilesForBlank[blankIndex][m];
+				tile = tileAt[cell];
+
+				if(tile == NOGROUP)
+				{
+					if(costs[rank * BOARDSIZE + cell] > cost)
+					{
+						costs[rank * BOARDSIZE + cell] = (unsigned char) cost;
+						appendState(&current, &currentCount, &currentSize, (state & ~0xFU) | (unsigned int) cell);
+					}
+				}
+				else
+				{
+					positions[tile] = blankIndex;
+					childRank = rankPattern(positions, group->tileCount);
+					positions[tile] = cell;
+
+					if(costs[childRank * BOARDSIZE + cell] > cost + 1)
+					{
+						costs[childRank * BOARDSIZE + cell] = (unsigned char) (cost + 1);
+						childState = (state & ~(0xFU << STATESHIFT(tile)) & ~0xFU)
+							| ((unsigned int) blankIndex << STATESHIFT(tile)) | (unsigned int) cell;
+						appendState(&next, &nextCount, &nextSize, childState);
+					}
+				}
+			}
+		}
+
+		swapLevel = current;
+		current = next;
+		next = swapLevel;
+		currentCount = nextCount;
+		nextCount = 0;
+		i = currentSize;
+		currentSize = nextSize;
+		nextSize = i;
+		cost++;
+	}
+
+	trackedFree(costs, group->entries * BOARDSIZE);
+	trackedFree(current, currentSize * sizeof(unsigned int));
+	trackedFree(next, nextSize * sizeof(unsigned int));
+}
+
+/**
+*Name: buildPartition
+*Purpose: This function will generate the table of every group of the
+	partition that does not have one yet.
+*Parameters:
+*	partition --partition to build
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void buildPartition(struct partition *partition)
+{
+	int g;									//group we are building
+	int t;									//loop control variable
+
+	if(partition->built == 1)
+	{
+		return;
+	}
+
+	for(t = 0; t < BOARDSIZE; t++)
+	{
+		partition->groupOfTile[t] = NOGROUP;
+	}
+
+	for(g = 0; g < partition->groupCount; g++)
+	{
+		for(t = 0; t < partition->groups[g].tileCount; t++)
+		{
+			partition->groupOfTile[partition->groups[g].tiles[t]] = g;
+		}
+
+		if(partition->groups[g].distances == NULL)
+		{
+			generateGroup(&partition->groups[g]);
+		}
+	}
+
+	partition->built = 1;
+}
+
+/**
+*Name: releasePartition
+*Purpose: This function will free the tables of every group of the
+	partition, or unmap them if they came from a file. It can be built again after.
+*Parameters:
+*	partition --partition to release
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void releasePartition(struct partition *partition)
+{
+	int g;									//loop control variable
+
+	for(g = 0; g < partition->groupCount; g++)
+	{
+		if(partition->groups[g].distances != NULL && partition->mapping == NULL)
+		{
+			trackedFree(partition->groups[g].distances, partition->groups[g].entries);
+		}
+		partition->groups[g].distances = NULL;
+	}
+
+	if(partition->mapping != NULL)
+	{
+		munmap(partition->mapping, partition->mappingSize);
+		partition->mapping = NULL;
+	}
+
+	partition->built = 0;
+}
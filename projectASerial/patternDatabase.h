@@ -0,0 +1,140 @@
+/*NAME: patternDatabase.h
+DATE: Oct 17th 2026
+VERSION: 1.0
+FILENAME: patternDatabase.h
+PURPOSE: This is a header for patternDatabase.c
+AUTHOR: Andrew Gendreau
+*/
+
+#include <stddef.h>
+
+#ifndef PATH_H_
+#define PATH_H_
+#include "pathfinder.h"
+#endif
+
+#define MAXPATTERNTILES 7					//most tiles in one group, a generation state has to fit in 32 bits
+#define MAXPATTERNGROUPS 4					//most groups in one partition
+#define PATTERNUNSEEN 0xFF					//distance of an abstract state the generation has not reached
+#define NOGROUP -1						//group of the blank, it is in none
+
+/*
+* Reflecting the board about its main diagonal swaps rows and columns, so
+* the goal moves to the board with tile 2 where 5 was, 3 where 9 was and so on.
+* Relabelling each tile with the one at its reflected home gives the goal back.
+* reflectedIndex is the index an index is reflected to and reflectedTile is
+* the label a tile is given, both undo themselves.
+*/
+extern const int reflectedIndex[BOARDSIZE];
+extern const int reflectedTile[BOARDSIZE];
+
+/*
+	This is a struct for one group of a partition and its table. Only the tiles
+	of the group are looked at, the rest of the board is left blank, and the
+	table holds, for every way of placing the group's tiles, the fewest moves
+	of those tiles that get them all home. The places are turned into an index
+	with rankPattern, so a lookup is one read.
+*/
+struct patternGroup
+{
+	int tileCount;						//number of tiles in the group
+	int tiles[MAXPATTERNTILES];				//the tiles, their order fixes the ranking
+	unsigned long entries;					//16! / (16 - tileCount)!, every way to place the tiles
+	unsigned char *distances;				//fewest moves of the group's tiles, by rank
+};
+
+/*
+	This is a struct for a partition of the tiles into disjoint groups. A move
+	only ever moves one tile, so it is only ever counted by one group's table,
+	and the tables can be added together and still never overestimate.
+*/
+struct partition
+{
+	char *name;						//name it is picked by
+	int groupCount;						//number of groups
+	struct patternGroup groups[MAXPATTERNGROUPS];		//the groups, between them every tile once
+	int groupOfTile[BOARDSIZE];				//group each tile is in, filled in by buildPartition
+	int built;						//1 once every table has been generated
+	unsigned char *mapping;					//table file the tables point into, NULL if they were built here
+	size_t mappingSize;					//size of that file
+};
+
+/**
+*Name: findPartition
+*Purpose: This function will, given the name of a partition, return it.
+	Its tables are not built until buildPartition is called.
+*Parameters:
+*	name --555 or 663
+*Returns:
+	pointer to the partition
+	NULL if there is none with that name
+*Author: Andrew Gendreau
+**/
+struct partition *findPartition(char *name);
+
+/**
+*Name: buildPartition
+*Purpose: This function will generate the table of every group of the
+	partition that does not have one yet.
+*Parameters:
+*	partition --partition to build
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void buildPartition(struct partition *partition);
+
+/**
+*Name: rankPattern
+*Purpose: This function will, given the indexes the tiles of a group are at,
+	in the group's order, turn them into a number from 0 up to the group's
+	entries. The first tile has 16 places it can be, the next 15, and so on,
+	so each index is counted among the places still free.
+*Parameters:
+*	positions --1d index of each tile of the group
+	tileCount --number of tiles in the group
+*Returns:
+	the rank
+*Author: Andrew Gendreau
+**/
+unsigned long rankPattern(int positions[], int tileCount);
+
+/**
+*Name: groupRank
+*Purpose: This function will, given a group and where every tile is,
+	return the rank of the group's tiles.
+*Parameters:
+*	group --group to rank
+	where --1d index of every tile, by tile
+*Returns:
+	the rank
+*Author: Andrew Gendreau
+**/
+unsigned long groupRank(struct patternGroup *group, int where[BOARDSIZE]);
+
+/**
+*Name: reflectedGroupRank
+*Purpose: This function will, given a group and where every tile is, return
+	the rank of the group's tiles on the board reflected about its main
+	diagonal. Tile t of the reflected board is where reflectedTile[t] is on
+	the board, moved to the reflection of that index.
+*Parameters:
+*	group --group to rank
+	where --1d index of every tile on the board, by tile
+*Returns:
+	the rank
+*Author: Andrew Gendreau
+**/
+unsigned long reflectedGroupRank(struct patternGroup *group, int where[BOARDSIZE]);
+
+/**
+*Name: releasePartition
+*Purpose: This function will free the tables of every group of the
+	partition, or unmap them if they came from a file. It can be built again after.
+*Parameters:
+*	partition --partition to release
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void releasePartition(struct partition *partition);
@@ -0,0 +1,392 @@
+/*NAME: patternFile.c
+DATE: Oct 17th 2026
+VERSION: 1.0
+FILENAME: patternFile.c
+PURPOSE: This module will save the pattern database tables to disk and load them back.
+	Building the tables of a partition can take most of a minute, and every run of the
+	solver used to build them again. Instead they are written once with
+		./mys15p generate 663
+	and every run after that maps the file read only. Nothing is copied, the tables
+	are the pages the kernel keeps of the file, so every solver on the same machine
+	shares one copy and after the first run they are already in memory, and
+	startup is only the time to check the header.
+	The file is a patternFileHeader followed by the tables, each starting on a page
+	of the file. The header is checked against the partition the solver was built
+	with, and the file against the sizes in it, before any of it is used, so a file
+	from another version or partition, or one that was cut short, is never trusted.
+	Checking every table against its checksum reads the whole file, so that is
+	only done when the file is generated, or when it is asked for with
+		./mys15p verify 663
+AUTHOR: Andrew Gendreau
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#ifndef PATTERNFILE_H_
+#define PATTERNFILE_H_
+#include "patternFile.h"
+#endif
+
+#ifndef HASH_H_
+#define HASH_H_
+#include "hashList.h"
+#endif
+
+#define FNVOFFSET 0xcbf29ce484222325ULL					//starting value of an FNV-1a checksum
+#define FNVPRIME 0x100000001b3ULL					//FNV-1a multiplier
+
+/**
+*Name: tableChecksum
+*Purpose: This function will, given a table, work out its FNV-1a checksum.
+	The endgame table file uses it too.
+*Parameters:
+*	table --bytes to check
+	size --number of bytes
+*Returns:
+	the checksum
+*Author: Andrew Gendreau
+**/
+unsigned long long tableChecksum(const unsigned char *table, unsigned long long size)
+{
+	unsigned long long checksum;						//checksum so far
+	unsigned long long i;							//loop control variable
+
+	checksum = FNVOFFSET;
+
+	for(i = 0; i < size; i++)
+	{
+		checksum = (checksum ^ table[i]) * FNVPRIME;
+	}
+
+	return checksum;
+}
+
+/**
+*Name: patternFileName
+*Purpose: This function will, given a partition, write the name its tables
+	are saved under and loaded from by default, pdb followed by the
+	partition's name and .db.
+*Parameters:
+*	partition --partition to name the file for
+	fileName --buffer of PATTERNFILENAMESIZE to write the name to
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void patternFileName(struct partition *partition, char *fileName)
+{
+	snprintf(fileName, PATTERNFILENAMESIZE, "pdb%s.db", partition->name);
+}
+
+/**
+*Name: fillHeader
+*Purpose: This function will, given a partition, fill in the header its
+	file should have. The checksums are only worked out if the tables are there.
+*Parameters:
+*	partition --partition to describe
+	header --header to fill
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+static void fillHeader(struct partition *partition, struct patternFileHeader *header)
+{
+	unsigned long long offset;						//where the next table goes
+	int g;									//group we are describing
+	int t;									//loop control variable
+
+	memset(header, 0, sizeof(struct patternFileHeader));
+	memcpy(header->magic, PATTERNFILEMAGIC, PATTERNFILEMAGICSIZE);
+	header->version = PATTERNFILEVERSION;
+	header->groupCount = (unsigned int) partition->groupCount;
+	strncpy(header->partition, partition->name, PARTITIONNAMESIZE - 1);
+	header->goal = WINNINGHASH;
+
+	offset = PATTERNTABLEALIGN;
+
+	for(g = 0; g < partition->groupCount; g++)
+	{
+		header->tileCounts[g] = (unsigned int) partition->groups[g].tileCount;
+		header->entries[g] = 1;
+
+		for(t = 0; t < partition->groups[g].tileCount; t++)
+		{
+			header->tiles[g][t] = (unsigned int) partition->groups[g].tiles[t];
+			header->entries[g] = header->entries[g] * (BOARDSIZE - t);
+		}
+
+		header->offsets[g] = offset;
+		offset += (header->entries[g] + PATTERNTABLEALIGN - 1) / PATTERNTABLEALIGN * PATTERNTABLEALIGN;
+
+		if(partition->groups[g].distances != NULL)
+		{
+			header->checksums[g] = tableChecksum(partition->groups[g].distances, header->entries[g]);
+		}
+	}
+}
+
+/**
+*Name: writePatternFile
+*Purpose: This function will, given a built partition and a file name,
+	write the header and every table of the partition to that file.
+*Parameters:
+*	partition --partition to write, it has to be built
+	fileName --file to write
+*Returns:
+	PATTERNFILEOK if the file was written
+	PATTERNFILEWRITEFAILED if it could not be
+*Author: Andrew Gendreau
+**/
+int writePatternFile(struct partition *partition, char *fileName)
+{
+	struct patternFileHeader header;					//header of the file
+	FILE *filePointer;							//file being written
+	int g;									//table being written
+	int failed;								//1 once a write has failed
+
+	fillHeader(partition, &header);
+
+	filePointer = fopen(fileName, "wb");
+
+	if(filePointer == NULL)
+	{
+		return PATTERNFILEWRITEFAILED;
+	}
+
+	failed = 0;
+
+	if(fwrite(&header, sizeof(header), 1, filePointer) != 1)
+	{
+		failed = 1;
+	}
+
+	for(g = 0; g < partition->groupCount && failed == 0; g++)
+	{
+		if(fseek(filePointer, (long) header.offsets[g], SEEK_SET) != 0
+			|| fwrite(partition->groups[g].distances, 1, header.entries[g], filePointer) != header.entries[g])
+		{
+			failed = 1;
+		}
+	}
+
+	if(fclose(filePointer) != 0 || failed == 1)
+	{
+		remove(fileName);
+		return PATTERNFILEWRITEFAILED;
+	}
+
+	return PATTERNFILEOK;
+}
+
+/**
+*Name: checkHeader
+*Purpose: This function will, given a partition, the header of a file and
+	the size of the file, check the file is one this build wrote for that partition.
+*Parameters:
+*	partition --partition the file should be for
+	header --header read from the file
+	fileSize --size of the file in bytes
+*Returns:
+	PATTERNFILEOK if the header is right
+	PATTERNFILEFOREIGN, PATTERNFILEMISMATCH or PATTERNFILESHORT if not
+*Author: Andrew Gendreau
+**/
+static int checkHeader(struct partition *partition, const struct patternFileHeader *header, unsigned long long fileSize)
+{
+	struct patternFileHeader expected;					//header this build would write
+	int g;									//group we are checking
+
+	if(memcmp(header->magic, PATTERNFILEMAGIC, PATTERNFILEMAGICSIZE) != 0 || header->version != PATTERNFILEVERSION)
+	{
+		return PATTERNFILEFOREIGN;
+	}
+
+	fillHeader(partition, &expected);
+
+	if(header->groupCount != expected.groupCount || header->goal != expected.goal
+		|| strncmp(header->partition, expected.partition, PARTITIONNAMESIZE) != 0
+		|| memcmp(header->tileCounts, expected.tileCounts, sizeof(expected.tileCounts)) != 0
+		|| memcmp(header->tiles, expected.tiles, sizeof(expected.tiles)) != 0
+		|| memcmp(header->entries, expected.entries, sizeof(expected.entries)) != 0
+		|| memcmp(header->offsets, expected.offsets, sizeof(expected.offsets)) != 0)
+	{
+		return PATTERNFILEMISMATCH;
+	}
+
+	for(g = 0; g < partition->groupCount; g++)
+	{
+		if(header->offsets[g] > fileSize || header->entries[g] > fileSize - header->offsets[g])	//so the sum can not wrap
+		{
+			return PATTERNFILESHORT;
+		}
+	}
+
+	return PATTERNFILEOK;
+}
+
+/**
+*Name: mapPatternFile
+*Purpose: This function will, given a partition and a file name, map the
+	file read only and check its header and size against the partition.
+	If they are right, the tables of the partition point into the mapping, so
+	every process that maps the same file shares the same pages. The
+	checksums are left to verifyPatternFile.
+*Parameters:
+*	partition --partition to load the tables of
+	fileName --file to map
+*Returns:
+	PATTERNFILEOK if the tables were mapped
+	one of the other PATTERNFILE codes if not, the partition is left as it was
+*Author: Andrew Gendreau
+**/
+int mapPatternFile(struct partition *partition, char *fileName)
+{
+	struct patternFileHeader *header;					//header at the start of the mapping
+	struct stat fileInfo;							//size of the file
+	unsigned char *mapping;							//the whole file
+	int fileDescriptor;							//the open file
+	int result;								//what the header check found
+	int g;									//group we are pointing at its table
+
+	fileDescriptor = open(fileName, O_RDONLY);
+
+	if(fileDescriptor < 0)
+	{
+		return PATTERNFILEMISSING;
+	}
+
+	if(fstat(fileDescriptor, &fileInfo) != 0 || (size_t) fileInfo.st_size < sizeof(struct patternFileHeader))
+	{
+		close(fileDescriptor);
+		return PATTERNFILESHORT;
+	}
+
+	mapping = mmap(NULL, (size_t) fileInfo.st_size, PROT_READ, MAP_SHARED, fileDescriptor, 0);
+	close(fileDescriptor);							//the mapping keeps the file open
+
+	if(mapping == MAP_FAILED)
+	{
+		return PATTERNFILEMISSING;
+	}
+
+	header = (struct patternFileHeader *) mapping;
+	result = checkHeader(partition, header, (unsigned long long) fileInfo.st_size);
+
+	if(result != PATTERNFILEOK)
+	{
+		munmap(mapping, (size_t) fileInfo.st_size);
+		return result;
+	}
+
+	releasePartition(partition);
+
+	for(g = 0; g < partition->groupCount; g++)
+	{
+		partition->groups[g].entries = (unsigned long) header->entries[g];
+		partition->groups[g].distances = mapping + header->offsets[g];
+	}
+
+	partition->mapping = mapping;
+	partition->mappingSize = (size_t) fileInfo.st_size;
+
+	return PATTERNFILEOK;
+}
+
+/**
+*Name: verifyPatternFile
+*Purpose: This function will, given a partition mapped from its file, work
+	out the checksum of every table and check it against the one in the header.
+*Parameters:
+*	partition --partition to check, it has to be mapped
+*Returns:
+	PATTERNFILEOK if every table matches
+	PATTERNFILECORRUPT if one does not
+*Author: Andrew Gendreau
+**/
+int verifyPatternFile(struct partition *partition)
+{
+	struct patternFileHeader *header;					//header at the start of the mapping
+	int g;									//group we are checking
+
+	header = (struct patternFileHeader *) partition->mapping;
+
+	for(g = 0; g < partition->groupCount; g++)
+	{
+		if(tableChecksum(partition->groups[g].distances, header->entries[g]) != header->checksums[g])
+		{
+			return PATTERNFILECORRUPT;
+		}
+	}
+
+	return PATTERNFILEOK;
+}
+
+/**
+*Name: patternFileError
+*Purpose: This function will, given a code returned by the functions above, describe it.
+*Parameters:
+*	code --a PATTERNFILE code
+*Returns:
+	a description of the code
+*Author: Andrew Gendreau
+**/
+char *patternFileError(int code)
+{
+	switch(code)
+	{
+		case PATTERNFILEOK:
+			return "valid";
+		case PATTERNFILEMISSING:
+			return "could not be opened";
+		case PATTERNFILESHORT:
+			return "is shorter than its header says";
+		case PATTERNFILEFOREIGN:
+			return "is not a pattern database file of this version";
+		case PATTERNFILEMISMATCH:
+			return "was made for a different partition";
+		case PATTERNFILECORRUPT:
+			return "does not match its checksums";
+		case PATTERNFILEWRITEFAILED:
+			return "could not be written";
+	}
+
+	return "failed";
+}
+
+/**
+*Name: loadPartition
+*Purpose: This function will, given a partition, map its tables from the
+	default file if there is a valid one, and build whatever is still
+	missing. A file that is there but not valid is reported and ignored.
+*Parameters:
+*	partition --partition to load
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void loadPartition(struct partition *partition)
+{
+	char fileName[PATTERNFILENAMESIZE];					//default file of the partition
+	int result;								//what mapping it found
+
+	if(partition->built == 1)
+	{
+		return;
+	}
+
+	patternFileName(partition, fileName);
+	result = mapPatternFile(partition, fileName);
+
+	if(result != PATTERNFILEOK && result != PATTERNFILEMISSING)
+	{
+		printf("%s %s, building the tables instead\n", fileName, patternFileError(result));
+	}
+
+	buildPartition(partition);
+}
@@ -0,0 +1,143 @@
+/*NAME: patternFile.h
+DATE: Oct 17th 2026
+VERSION: 1.0
+FILENAME: patternFile.h
+PURPOSE: This is a header for patternFile.c
+AUTHOR: Andrew Gendreau
+*/
+
+#ifndef PATTERNDB_H_
+#define PATTERNDB_H_
+#include "patternDatabase.h"
+#endif
+
+#define PATTERNFILEMAGIC "15PPDB\r\n"				//first 8 bytes of every table file
+#define PATTERNFILEMAGICSIZE 8
+#define PATTERNFILEVERSION 1					//raised whenever the layout below changes
+#define PARTITIONNAMESIZE 16					//room for a partition name in the header
+#define PATTERNTABLEALIGN 4096					//every table starts on a page of the file
+#define PATTERNFILENAMESIZE 64					//room for the default name of a table file
+
+#define PATTERNFILEOK 0						//the file was mapped and is valid
+#define PATTERNFILEMISSING -1					//the file could not be opened
+#define PATTERNFILESHORT -2					//the file is smaller than its header says
+#define PATTERNFILEFOREIGN -3					//the magic or version is wrong
+#define PATTERNFILEMISMATCH -4					//partition, goal or groups do not match this build
+#define PATTERNFILECORRUPT -5					//a table does not match its checksum
+#define PATTERNFILEWRITEFAILED -6				//the file could not be written
+
+/*
+	This is the header at the start of every table file. It says which
+	partition the tables are for, down to the tiles of every group, the goal
+	the distances are measured to and where each table is in the file, with a
+	checksum of each. Every field but the checksums is checked before any
+	table is used.
+*/
+struct patternFileHeader
+{
+	char magic[PATTERNFILEMAGICSIZE];			//PATTERNFILEMAGIC
+	unsigned int version;					//PATTERNFILEVERSION
+	unsigned int groupCount;				//number of tables
+	char partition[PARTITIONNAMESIZE];			//name of the partition
+	unsigned long long goal;				//key of the goal the tables lead to
+	unsigned int tileCounts[MAXPATTERNGROUPS];		//tiles in each group
+	unsigned int tiles[MAXPATTERNGROUPS][MAXPATTERNTILES];	//the tiles of each group, in ranking order
+	unsigned long long entries[MAXPATTERNGROUPS];		//bytes in each table
+	unsigned long long offsets[MAXPATTERNGROUPS];		//where each table starts in the file
+	unsigned long long checksums[MAXPATTERNGROUPS];		//FNV-1a checksum of each table
+};
+
+/**
+*Name: tableChecksum
+*Purpose: This function will, given a table, work out its FNV-1a checksum.
+	The endgame table file uses it too.
+*Parameters:
+*	table --bytes to check
+	size --number of bytes
+*Returns:
+	the checksum
+*Author: Andrew Gendreau
+**/
+unsigned long long tableChecksum(const unsigned char *table, unsigned long long size);
+
+/**
+*Name: patternFileName
+*Purpose: This function will, given a partition, write the name its tables
+	are saved under and loaded from by default, pdb followed by the
+	partition's name and .db.
+*Parameters:
+*	partition --partition to name the file for
+	fileName --buffer of PATTERNFILENAMESIZE to write the name to
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void patternFileName(struct partition *partition, char *fileName);
+
+/**
+*Name: writePatternFile
+*Purpose: This function will, given a built partition and a file name,
+	write the header and every table of the partition to that file.
+*Parameters:
+*	partition --partition to write, it has to be built
+	fileName --file to write
+*Returns:
+	PATTERNFILEOK if the file was written
+	PATTERNFILEWRITEFAILED if it could not be
+*Author: Andrew Gendreau
+**/
+int writePatternFile(struct partition *partition, char *fileName);
+
+/**
+*Name: mapPatternFile
+*Purpose: This function will, given a partition and a file name, map the
+	file read only and check its header and size against the partition.
+	If they are right, the tables of the partition point into the mapping, so
+	every process that maps the same file shares the same pages. The
+	checksums are left to verifyPatternFile.
+*Parameters:
+*	partition --partition to load the tables of
+	fileName --file to map
+*Returns:
+	PATTERNFILEOK if the tables were mapped
+	one of the other PATTERNFILE codes if not, the partition is left as it was
+*Author: Andrew Gendreau
+**/
+int mapPatternFile(struct partition *partition, char *fileName);
+
+/**
+*Name: verifyPatternFile
+*Purpose: This function will, given a partition mapped from its file, work
+	out the checksum of every table and check it against the one in the header.
+*Parameters:
+*	partition --partition to check, it has to be mapped
+*Returns:
+	PATTERNFILEOK if every table matches
+	PATTERNFILECORRUPT if one does not
+*Author: Andrew Gendreau
+**/
+int verifyPatternFile(struct partition *partition);
+
+/**
+*Name: patternFileError
+*Purpose: This function will, given a code returned by the functions above, describe it.
+*Parameters:
+*	code --a PATTERNFILE code
+*Returns:
+	a description of the code
+*Author: Andrew Gendreau
+**/
+char *patternFileError(int code);
+
+/**
+*Name: loadPartition
+*Purpose: This function will, given a partition, map its tables from the
+	default file if there is a valid one, and build whatever is still
+	missing. A file that is there but not valid is reported and ignored.
+*Parameters:
+*	partition --partition to load
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void loadPartition(struct partition *partition);
@@ -1,27 +1,43 @@
 /*NAME: puzzleSolver.c
 DATE: Oct 14th 2016
-VERSION: 2.0
+VERSION: 3.0
 FILENAME: puzzleSolver.c
 PURPOSE: This module will be the algorithm implementer module.
-	It will use hashList, Yggdrasil and pathfinder to solve the puzzle.
+	It will use hashList, the search tree and pathfinder to solve the puzzle.
 	It will use the following algorithm:
-		1. It will initalize Yggdrasil and the hashList.
+		1. It will initalize the search tree and the hashList.
 		2. It will hash the inital board state and enter it in the hashList.
 		3. Then, beginning at the root, for every node i at level l:
 			4. Set l to be the depth we are working with, (the number of moves from the root)
 			5. calculate the possible moves m from that board position
 			6. Check each of the moves calculated for board positions we have seen before to find m' (# of new moves)
 			6. spawn m' new nodes
-			7. Insert them into Yggdrasil as node i's children
+			7. Add them to the search tree with node i as their parent
 			8. Do this for every node on level l.
 			8a: If the hash for child c is the winning one, stop, we've found our winning state.
 			8b: else, we have exhausted this level, increment l and move down.
-	The breadth first traversal needed for this algorithm to work will be implemented using a queue as follows:
-		Keep two counters, one will hold the number of nodes at the current level
-		de queue nodes one by one until we've done all for that level, when we insert new nodes into Yggdrasil,
-		we will increment the second counter meant to hold the nodes in the next level.
-		Once we have dealt with all the nodes at a given level, we will put the second counter's value into the first
-		one and set the second counter to 0.
+	The breadth first traversal needed for this algorithm to work comes from the order
+	nodes are added to the search tree:
+		The children of a level are added after every node of that level, in the
+		order their parents were expanded, so each level is one run of indices.
+		Keep the first index of the current level and the index one past its end,
+		go through that run in order, and once it is done the next level is the run
+		from the old end to the number of nodes in the tree now.
+	In a lean search the nodes before the current level are released each time
+	the search moves down a level, only their parent links are kept for the path.
+	The boards seen are also only kept for two levels. Every move changes the
+	parity of the blank's row and of the tile order together, so a move always
+	goes from a board an even number of moves from the root to an odd one or back.
+	A child of a node on level l can only be on level l - 1 or l + 1, so those are
+	the only two levels that have to be checked for it. The table of level l - 1
+	is made from that level's nodes just before they are released, sized for
+	exactly that many boards, and the table of level l + 1 starts sized for as
+	many boards as level l has, so neither is grown from a fixed size, and held
+	twice while it is, on the largest levels.
+	The parent links are 4 more bytes a node, so a lean search only holds less
+	at its peak once the levels it releases outweigh them, from about 12 moves.
+	Below that every part still fits in its first chunks and a full search
+	holds a little less.
 AUTHOR: Andrew Gendreau
 */
 
@@ -31,16 +47,54 @@ AUTHOR: Andrew Gendreau
 
 #include "puzzleSolver.h"
 
+#ifndef MEMORY_H_
+#define MEMORY_H_
+#include "memoryTracker.h"
+#endif
+
+#ifndef SEARCHLIMITS_H_
+#define SEARCHLIMITS_H_
+#include "searchLimits.h"
+#endif
+
 int currentDepth = 0;							//depth of the nodes we're working with right now
-extern int currentLevelNodeCount;					//node count at the current level
-extern int nextLevelNodeCount;						//node count at the next level
-extern struct tree *treeRoot;						//root of the tree of board positions and moves
+unsigned long long nodesExpanded = 0;					//number of nodes processNode has expanded
+int leanSearch = 0;							//1 to release the nodes of finished levels
+extern struct hashList *head;						//table of every position seen by a full search
+struct hashList *previousLevelSeen = NULL;				//lean search, boards on the level before the current one
+struct hashList *nextLevelSeen = NULL;					//lean search, boards found so far on the next level
+unsigned int levelStart = 0;						//index of the first node of the current level
+unsigned int levelEnd = 0;						//index one past the last node of the current level
+unsigned int winnerIndex = ROOTPARENT;					//index of the winning node once we have found it
+
+/**
+*Name: givenAWinner
+*Purpose: This function will, given the key of the board the user gave us,
+	check if it is already the winning state, and tell them if it is. An
+	engine that builds a tree shares this check on its root.
+*Parameters: 
+*	rootHash --key of the given board
+*Returns:
+	1 if it is the winning state
+	0 if it is not
+*Author: Andrew Gendreau
+**/
+int givenAWinner(boardKey rootHash)
+{
+	if(rootHash == WINNINGHASH)
+	{
+		printf("You gave me a winning state!\n");
+		return 1;
+	}
+
+	return 0;
+}
 
 /**
 *Name: createRoot
 *Purpose: This function will, given an array of ints to
 	represent the board, create the node for the root of 
-	Yggdrasil and insert it. It will also run a check for if the
+	the search tree and add it. It will also run a check for if the
 	given state is a winning one, if so it will return 1 to signal that.
 *Parameters: 
 *	board --inital board
@@ -52,183 +106,335 @@ extern struct tree *treeRoot;						//root of the tree of board positions and mov
 **/
 int createRoot(int board[BOARDSIZE])
 {
-	long int rootHash;						//hash of the root of Yggdrasil
-	struct treeNode *node;						//root node
+	boardKey rootHash;						//hash of the root of the search tree
 
-	createEmptyHashList();						//create a new hashList
+	if(leanSearch == 1)						//create a new hashList, or one for each level checked
+	{
+		previousLevelSeen = createHashList(1);			//the tables are sized from the levels as
+		nextLevelSeen = createHashList(1);			//they are made, the root's level is one board
+	}
+	else
+	{
+		createEmptyHashList();
+	}
 
-	rootHash = computeHashValue(board);				//compute the root's hash
+	initializeSearchTree(leanSearch);				//and an empty tree
 
-	if(rootHash == WINNINGHASH)
+	rootHash = encodeBoard(board);				//compute the root's hash
+
+	if(givenAWinner(rootHash) == 1)
 	{
-		printf("You gave me a winning state!\n");
 		return 1;
 	}
 
-	node = createNode(currentDepth, rootHash, board, -1, 0);
-
-	insertIntoYggdrasil(node, NULL);
+	haveIMadeThisPosition(rootHash);
 
-	enQueue(node);
+	levelStart = addSearchNode(rootHash, ROOTPARENT, NOMOVE, findBlankIndex(board));
+	levelEnd = levelStart + 1;
+	winnerIndex = ROOTPARENT;
 
 	currentDepth++;
 
 	return 0;
 }
 
+/**
+*Name: haveIMadeThisPosition
+*Purpose: This function will, given a hash value, check if the search has
+	already made that board and mark it as made if not. A full search keeps
+	every board in the one hashList. A lean search only checks the level
+	before the current one and the next level, and stores new boards in
+	the next level's table.
+*Parameters: 
+	hashVal --hash value for a given board position.
+*Returns:
+	1 if the board was made before
+	-1 if it was not.
+*Author: Andrew Gendreau
+**/
+int haveIMadeThisPosition(boardKey hashVal)
+{
+	if(leanSearch == 0)
+	{
+		return haveISeenThisPosition(hashVal);
+	}
+	else if(currentDepth == 0)					//the root, its level's table is made from its node
+	{
+		return -1;
+	}
+	else if(containsPosition(previousLevelSeen, hashVal) == 1)
+	{
+		return 1;
+	}
+	else
+	{
+		return insertPosition(nextLevelSeen, hashVal);
+	}
+}
+
 /**
 *Name: processNode
-*Purpose: This function will, given a node to process, run steps 5-8
-	of the above algorithm. It will find the x and y of the blank,
-	find how many moves are possible, the 1d indexes of the tiles we can
-	move in. Then, for every move we can make, it will copy the original board
-	into another variable to hold that node's board. Then, for each move we can,
-	it will swap the current index we can with the blank, then compute the hash value 
-	of that	new board. If that board is new, we will insert it as a child of the given
-	input node, if not, we won't bother making another node. We'll then check the hash,
-	for a winning position, if it is a winning position, we'll return an int to signal that.
-	otherwise, we'll enqueue the newly made node and increment the counter for the number of
-	nodes on the next level.	
+*Purpose: This function will, given the index of a node to process, run steps 5-8
+	of the above algorithm. It will look up how many moves are possible from
+	the node's blank position and the 1d indexes of the tiles we can move in
+	from the move tables in pathfinder.c. Then, for every move we can make, it will
+	compute the key of the board after that move straight from the node's key, since
+	only the blank and the tile moving change. The move straight back to the node's
+	parent is skipped, that board is always one we have seen. If the new board is new,
+	it will add it to the search tree with this node as its parent, if not, we won't
+	bother making another node. Nodes are added in the order they are made, so they
+	land on the end of the next level. We'll then check the hash for a winning position,
+	if it is a winning position, we'll return its index to signal that.
 *Parameters: 
-	currentNode --current node to process
+	nodeIndex --index of the node to process
 *Returns:
-	Index in current node's children array representing the winnning node
-	-1 if we haven't found a winner yet.
+	index of the winning node if one of the children won
+	ROOTPARENT if we haven't found a winner yet.
 *Author: Andrew Gendreau
 **/
-int processNode(struct treeNode *currentNode)
+unsigned int processNode(unsigned int nodeIndex)
 {
+	struct searchNode *currentNode;						//node we are expanding
 	int blankIndex;								//index of the current blank position
-	int blankX;								//x coordinate of the blank
-	int blankY;								//y coordinate of the blank
 	int movesPossible;							//the number of moves possible from this position
-	char *moveDirections;							//character string of the move directions
-	int *indexesToSwap;							//1d indexes of the tiles we can move into the blank spot
+	const int *moveDirections;						//direction codes of the moves, from the move tables
+	const int *indexesToSwap;						//1d indexes of the tiles we can move into the blank spot
 	int i;									//loop control variable
-	int currentIndex;							//current index we are swapping in
-	long int hashVal;							//hash value of the board after the swap
-	int tileWeAreMoving;							//The actual value of the tile we are moving
-	struct treeNode *newNode;						//the next node we are going to insert
-	int lastNodeInsertedPosition;						//the index in the children array of the last node we
-										//inserted
-	int seenBeforeSignal;
+	int backwards;								//direction that would undo the move into this node
+	boardKey hashVal;							//hash value of the board after the swap
+	unsigned int newNodeIndex;						//index of the child we just added
 
-	lastNodeInsertedPosition = -1;
+	nodesExpanded++;
 
-	blankIndex = findBlankIndex(currentNode->board);
+	currentNode = searchNodeAt(nodeIndex);
 
-	blankX = findX(blankIndex);
-	blankY = findY(blankIndex);
+	blankIndex = currentNode->blankIndex;
 
-	movesPossible = numberofMovesPossible(blankX, blankY);
+	movesPossible = movesForBlank[blankIndex];
 
-	moveDirections = findMoveDirections(movesPossible, blankX, blankY);
+	moveDirections = directionsForBlank[blankIndex];
 
-	indexesToSwap = tilesToMoveIn(movesPossible, blankX, blankY, moveDirections);
+	indexesToSwap = tilesForBlank[blankIndex];
+
+	if(currentNode->direction == (unsigned char) NOMOVE)
+	{
+		backwards = NOMOVE;
+	}
+	else
+	{
+		backwards = currentNode->direction ^ 1;
+	}
 
-	for(i = 0; i < 	movesPossible; i++)
+	for(i = 0; i < movesPossible; i++)
 	{
-		int nodeBoardCopy[BOARDSIZE];					//variable to hold the board post switch for this node
+		if(moveDirections[i] == backwards)
+		{
+			continue;
+		}
+
+		hashVal = applyMoveToKey(currentNode->key, blankIndex, indexesToSwap[i]);	//only two tiles change, so the
+												//child's key comes from ours
 
-		currentIndex = indexesToSwap[i];
+		if(haveIMadeThisPosition(hashVal) < 0)
+		{
+			newNodeIndex = addSearchNode(hashVal, nodeIndex, moveDirections[i], indexesToSwap[i]);
 
-		memcpy(nodeBoardCopy, currentNode->board, sizeof(nodeBoardCopy));	
+			if(hashVal == WINNINGHASH)
+			{
+				return newNodeIndex;
+			}
+		}
+	}
 
-		tileWeAreMoving = nodeBoardCopy[currentIndex];
+	return ROOTPARENT;
+}
 
-		swap(blankIndex, currentIndex, nodeBoardCopy);
+/**
+*Name: moveLeanTablesDown
+*Purpose: This function will, in a lean search that has finished a level, make
+	the table of boards checked against the boards of that level, from its nodes,
+	and start an empty table for the level after the new current one. The old
+	tables are freed first. The empty one is sized for as many boards as the new
+	current level has, levels only grow until near the end of a search.
+*Parameters: 
+	finishedStart --index of the first node of the finished level
+	finishedEnd --index one past its last node, the first of the new current level
+	currentEnd --index one past the last node of the new current level
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+static void moveLeanTablesDown(unsigned int finishedStart, unsigned int finishedEnd, unsigned int currentEnd)
+{
+	unsigned long long finishedCount;				//boards on the finished level
+	unsigned long long currentCount;				//boards on the new current level
+	unsigned int i;							//loop control variable
 
-		hashVal = computeHashValue(nodeBoardCopy);
+	finishedCount = finishedEnd - finishedStart;
+	currentCount = currentEnd - finishedEnd;
 
-		seenBeforeSignal = haveISeenThisPosition(hashVal);
+	destroyHashList(previousLevelSeen);
+	destroyHashList(nextLevelSeen);
 
-		if(seenBeforeSignal < 0)
-		{	
-			newNode = createNode(currentDepth, hashVal, nodeBoardCopy, tileWeAreMoving, moveDirections[i]);
+	previousLevelSeen = createHashList(finishedCount * MAXLOADDENOMINATOR / MAXLOADNUMERATOR + 1);
 
-			lastNodeInsertedPosition = insertIntoYggdrasil(newNode, currentNode);
-			
-			if(newNode->hashVal == WINNINGHASH)
-			{
-				return lastNodeInsertedPosition;
-			}	
-			else
-			{
-				enQueue(newNode);
-				nextLevelNodeCount++;
-			}
-		}
-		else
-		{
-			//do nothing
-		}
+	for(i = finishedStart; i < finishedEnd; i++)
+	{
+		insertPosition(previousLevelSeen, searchNodeAt(i)->key);
 	}
-	return -1;
+
+	nextLevelSeen = createHashList(currentCount * MAXLOADDENOMINATOR / MAXLOADNUMERATOR + 1);
 }
 
 /**
 *Name: processLevel
-*Purpose: This function will, given the number of nodes at this level,
-	will deQueue that many nodes from the queue and call processNode on them 
-	one at a time. It will wait for a return from processNode, if that return
-	is >= 0 that means we have found our winning hash and can stop. If it gets
-	all the way through that level and has not found a winner, it will move the second
-	node counter to equal the first and set the second to 0. Then increment currentDepth.
+*Purpose: This function will call processNode on every node of the current
+	level, in order, one at a time. It will wait for a return from processNode,
+	if that return is a node index that means we have found our winning
+	hash and can stop. If it gets all the way through that level and has not found
+	a winner, it will make the nodes added while doing so the current level and
+	increment currentDepth. In a lean search the nodes of the finished level are
+	released then and the tables of boards seen move down a level. The children
+	made are currentDepth moves from the root, createRoot counts the root's level,
+	and that is the depth the search limits are charged with, every
+	LIMITCHECKNODES nodes.
 *Parameters: 
-	nodesAtThisLevel --nodes at the this level, needed so we only deQueue that many nodes 
-	from the queue
+	void
 *Returns:
-	1 if we've won
+	1 if we've won, winnerIndex is then the winning node
 	-1 if we have not
+	-100 if the current level is empty, there is nothing left to search
+	LIMITREACHED if a search limit was reached, no path is shorter than currentDepth
 *Author: Andrew Gendreau
 **/
-int processLevel(int nodesAtThisLevel)
+int processLevel(void)
 {
-	int nodesToProcess;					//nodes we need to process at this level
-	struct treeNode *currentNode;				//node we're processing right now
-	int i;							//loop control variable
-	//char *winningPath;					//string that represents the winning path
-	int haveIWon;						//integer to keep track of if we've won
+	unsigned int i;						//loop control variable
+	unsigned int haveIWon;					//index of the winning node, ROOTPARENT until we win
 
-	haveIWon = -1;
-
-	nodesToProcess = nodesAtThisLevel;
+	if(levelStart == levelEnd)
+	{
+		printf("I ran out of nodes\n");
+		return -100;
+	}
 
-	for(i = 0; i < nodesToProcess; i++)
+	if(chargeSearchLimits(0, currentDepth) != LIMITNONE)
 	{
-		currentNode = deQueue();
+		return stopAtLimit(currentDepth);
+	}
 
-		if(currentNode == NULL)
+	for(i = levelStart; i < levelEnd; i++)
+	{
+		haveIWon = processNode(i);
+		
+		if(haveIWon != ROOTPARENT)
 		{
-			printf("Null dequque again?\n");
-			return -100;
+			winnerIndex = haveIWon;
+			return 1;
 		}
 
-		haveIWon = processNode(currentNode);
-		
-		if(haveIWon >= 0)
+		if(nodesExpanded % LIMITCHECKNODES == 0 && chargeSearchLimits(LIMITCHECKNODES, currentDepth) != LIMITNONE)
 		{
-			//winningPath = traverseWinningPath(currentNode->children[haveIWon]);
-
-			//printf("The winning path is: %s\n", winningPath);
-			printf("It took %d moves\n", currentNode->children[haveIWon]->depth);
-			return 1;
+			return stopAtLimit(currentDepth);
 		}
 	}
-	currentLevelNodeCount = nextLevelNodeCount;
-	nextLevelNodeCount = 0;
+	if(leanSearch == 1)						//the tables move down a level with the search,
+	{								//while the finished level's nodes are still there
+		moveLeanTablesDown(levelStart, levelEnd, searchNodeCount());
+	}
+
+	levelStart = levelEnd;
+	levelEnd = searchNodeCount();
+	releaseSearchNodesBefore(levelStart);
+
 	currentDepth++;
 	return -1;
 }
 
+/**
+*Name: breadthFirstSolve
+*Purpose: This function will, given a 1d array that represents the inital board state,
+	use it to create the root node and call processLevel a level at a time
+	until it has won, run out of nodes or reached a search limit, then fill
+	path with the moves from the root to the winner. The depth and the nodes
+	expanded are started again, so it can be called for one board after
+	another. The tree and the boards seen are kept until releaseBreadthFirst.
+*Parameters: 
+	board --1d Int array to hold the root board
+	path --path to fill
+*Returns:
+	the number of moves on the path
+	0 if it was given a winning board, createRoot has told the user
+	-1 if it ran out of nodes
+	LIMITREACHED if a search limit was reached
+*Author: Andrew Gendreau
+**/
+int breadthFirstSolve(int board[BOARDSIZE], struct movePath *path)
+{
+	int haveWeFoundAWinner;					//integer to signal us if we've won
+
+	currentDepth = 0;
+	nodesExpanded = 0;
+	path->length = 0;
+
+	if(createRoot(board) == 1)
+	{
+		return 0;
+	}
+
+	haveWeFoundAWinner = processLevel();
+	
+	while(haveWeFoundAWinner == -1)
+	{
+		haveWeFoundAWinner = processLevel();
+	}
+
+	if(haveWeFoundAWinner == 1)
+	{
+		return traceSearchPath(winnerIndex, path);
+	}
+
+	if(haveWeFoundAWinner == LIMITREACHED)
+	{
+		return LIMITREACHED;
+	}
+
+	return -1;
+}
+
+/**
+*Name: releaseBreadthFirst
+*Purpose: This function will free the tree and the boards seen by the last
+	breadthFirstSolve.
+*Parameters: 
+	void
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void releaseBreadthFirst(void)
+{
+	releaseSearchTree();
+
+	if(leanSearch == 1)
+	{
+		destroyHashList(previousLevelSeen);
+		destroyHashList(nextLevelSeen);
+	}
+	else
+	{
+		destroyHashList(head);
+	}
+}
+
 /**
 *Name: runTest
 *Purpose: This function will, given a 1d array that represents the inital board state,
-	first use that board to create the root node, it will check the return from createRoot
-	to check for the case if we're given a solved puzzle already. It will call processLevel
-	with 1 to signify calling it with only the root node. It will keep a variable to keep track of
-	if we have found a winner or not, if we get to the end of a call of processLevel and have not
-	gotten the winner signal, we'll call it again for the next level.
+	solve it with breadthFirstSolve and print the length of the path and its moves,
+	or, if a search limit stopped it, which and the fewest moves a path can have.
+	It will then print how many nodes were expanded, how many heap allocations the
+	search made doing so, the most heap it held at once and how much the tree
+	held, then free the tree and the boards seen.
 *Parameters: 
 	board --1d Int array to hold the root board
 *Returns:
@@ -237,22 +443,36 @@ int processLevel(int nodesAtThisLevel)
 **/
 void runTest(int board[BOARDSIZE])
 {
-	int haveWeFoundAWinner;					//integer to signal us if we've won
-	int wereWeGivenAWinner;					//integer to signal if we were given a winning board
-	
-	wereWeGivenAWinner = createRoot(board);
+	struct movePath winningPath;				//the moves from the root to the winner
+	char winningMoves[PATHTEXTSIZE];			//text of those moves
+	int length;						//what the solve returned
+	unsigned long long allocationsBefore;			//heap allocations made before the search started
+
+	allocationsBefore = memoryUsage.allocations;
 
-	if(wereWeGivenAWinner == 1)
+	length = breadthFirstSolve(board, &winningPath);
+
+	if(length == 0)						//we were given a winning board
 	{
 		return;
 	}
-	else
+
+	if(length == LIMITREACHED)
 	{
-		haveWeFoundAWinner = processLevel(1);
-		
-		while(haveWeFoundAWinner != 1)
-		{
-			haveWeFoundAWinner = processLevel(currentLevelNodeCount);
-		}
+		reportSearchLimit();
 	}
+	else if(length > 0)
+	{
+		formatMovePath(&winningPath, winningMoves);
+
+		printf("It took %d moves\n", winningPath.length);
+		printf("The moves were: %s\n", winningMoves);
+	}
+
+	printf("Expanded %llu nodes with %llu heap allocations\n", nodesExpanded,
+		memoryUsage.allocations - allocationsBefore);
+	printf("Peak heap use was %lu bytes\n", (unsigned long) memoryUsage.peakBytes);
+	printSearchTreeStats();
+
+	releaseBreadthFirst();
 }
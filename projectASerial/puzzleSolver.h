@@ -1,14 +1,14 @@
 /*NAME: puzzleSolver.h
 DATE: Oct 14th 2016
-VERSION: 2.0
+VERSION: 3.0
 FILENAME: puzzleSolver.h
 PURPOSE: This is a module for puzzleSolver.c
 AUTHOR: Andrew Gendreau
 */
 
-#ifndef YGGDRASIL_H_
-#define YGGDRASIL_H_
-#include "yggdrasil.h"
+#ifndef SEARCHTREE_H_
+#define SEARCHTREE_H_
+#include "searchTree.h"
 #endif
 
 #ifndef HASH_H_
@@ -16,11 +16,6 @@ AUTHOR: Andrew Gendreau
 #include "hashList.h"
 #endif
 
-#ifndef QUEUE_H_
-#define QUEUE_H_
-#include "queue.h"
-#endif
-
 #ifndef PATH_H_
 #define PATH_H_
 #include "pathfinder.h"
@@ -30,11 +25,25 @@ AUTHOR: Andrew Gendreau
 #define BOARDHEIGHT 4							//how many rows the board has
 #define BOARDSIZE 16							//the size of the board, 4x4, so 16 elements total.
 
+/**
+*Name: givenAWinner
+*Purpose: This function will, given the key of the board the user gave us,
+	check if it is already the winning state, and tell them if it is. An
+	engine that builds a tree shares this check on its root.
+*Parameters: 
+*	rootHash --key of the given board
+*Returns:
+	1 if it is the winning state
+	0 if it is not
+*Author: Andrew Gendreau
+**/
+int givenAWinner(boardKey rootHash);
+
 /**
 *Name: createRoot
 *Purpose: This function will, given an array of ints to
 	represent the board, create the node for the root of 
-	Yggdrasil and insert it. It will also run a check for if the
+	the search tree and add it. It will also run a check for if the
 	given state is a winning one, if so it will return 1 to signal that.
 *Parameters: 
 *	board --inital board
@@ -46,54 +55,107 @@ AUTHOR: Andrew Gendreau
 **/
 int createRoot(int board[BOARDSIZE]);
 
+/**
+*Name: haveIMadeThisPosition
+*Purpose: This function will, given a hash value, check if the search has
+	already made that board and mark it as made if not. A full search keeps
+	every board in the one hashList. A lean search only checks the level
+	before the current one and the next level, and stores new boards in
+	the next level's table.
+*Parameters: 
+	hashVal --hash value for a given board position.
+*Returns:
+	1 if the board was made before
+	-1 if it was not.
+*Author: Andrew Gendreau
+**/
+int haveIMadeThisPosition(boardKey hashVal);
+
 /**
 *Name: processNode
-*Purpose: This function will, given a node to process, run steps 5-8
-	of the above algorithm. It will find the x and y of the blank,
-	find how many moves are possible, the 1d indexes of the tiles we can
-	move in. Then, for every move we can make, it will copy the original board
-	into another variable to hold that node's board. Then, for each move we can,
-	it will swap the current index we can with the blank, then compute the hash value 
-	of that	new board. If that board is new, we will insert it as a child of the given
-	input node, if not, we won't bother making another node. We'll then check the hash,
-	for a winning position, if it is a winning position, we'll return an int to signal that.
-	otherwise, we'll enqueue the newly made node and increment the counter for the number of
-	nodes on the next level.	
+*Purpose: This function will, given the index of a node to process, run steps 5-8
+	of the above algorithm. It will look up how many moves are possible from
+	the node's blank position and the 1d indexes of the tiles we can move in
+	from the move tables in pathfinder.c. Then, for every move we can make, it will
+	compute the key of the board after that move straight from the node's key, since
+	only the blank and the tile moving change. The move straight back to the node's
+	parent is skipped, that board is always one we have seen. If the new board is new,
+	it will add it to the search tree with this node as its parent, if not, we won't
+	bother making another node. Nodes are added in the order they are made, so they
+	land on the end of the next level. We'll then check the hash for a winning position,
+	if it is a winning position, we'll return its index to signal that.
 *Parameters: 
-	currentNode --current node to process
+	nodeIndex --index of the node to process
 *Returns:
-	Index in current node's children array representing the winnning node
-	-1 if we haven't found a winner yet.
+	index of the winning node if one of the children won
+	ROOTPARENT if we haven't found a winner yet.
 *Author: Andrew Gendreau
 **/
-int processNode(struct treeNode *currentNode);
+unsigned int processNode(unsigned int nodeIndex);
 
 /**
 *Name: processLevel
-*Purpose: This function will, given the number of nodes at this level,
-	will deQueue that many nodes from the queue and call processNode on them 
-	one at a time. It will wait for a return from processNode, if that return
-	is >= 0 that means we have found our winning hash and can stop. If it gets
-	all the way through that level and has not found a winner, it will move the second
-	node counter to equal the first and set the second to 0. Then increment currentDepth.
+*Purpose: This function will call processNode on every node of the current
+	level, in order, one at a time. It will wait for a return from processNode,
+	if that return is a node index that means we have found our winning
+	hash and can stop. If it gets all the way through that level and has not found
+	a winner, it will make the nodes added while doing so the current level and
+	increment currentDepth. In a lean search the nodes of the finished level are
+	released then and the tables of boards seen move down a level. The children
+	made are currentDepth moves from the root, createRoot counts the root's level,
+	and that is the depth the search limits are charged with, every
+	LIMITCHECKNODES nodes.
 *Parameters: 
-	nodesAtThisLevel --nodes at the this level, needed so we only deQueue that many nodes 
-	from the queue
+	void
 *Returns:
-	1 if we've won
+	1 if we've won, winnerIndex is then the winning node
 	-1 if we have not
+	-100 if the current level is empty, there is nothing left to search
+	LIMITREACHED if a search limit was reached, no path is shorter than currentDepth
+*Author: Andrew Gendreau
+**/
+int processLevel(void);
+
+/**
+*Name: breadthFirstSolve
+*Purpose: This function will, given a 1d array that represents the inital board state,
+	use it to create the root node and call processLevel a level at a time
+	until it has won, run out of nodes or reached a search limit, then fill
+	path with the moves from the root to the winner. The depth and the nodes
+	expanded are started again, so it can be called for one board after
+	another. The tree and the boards seen are kept until releaseBreadthFirst.
+*Parameters: 
+	board --1d Int array to hold the root board
+	path --path to fill
+*Returns:
+	the number of moves on the path
+	0 if it was given a winning board, createRoot has told the user
+	-1 if it ran out of nodes
+	LIMITREACHED if a search limit was reached
+*Author: Andrew Gendreau
+**/
+int breadthFirstSolve(int board[BOARDSIZE], struct movePath *path);
+
+/**
+*Name: releaseBreadthFirst
+*Purpose: This function will free the tree and the boards seen by the last
+	breadthFirstSolve.
+*Parameters: 
+	void
+*Returns:
+	void
 *Author: Andrew Gendreau
 **/
-int processLevel(int nodesAtThisLevel);
+void releaseBreadthFirst(void);
 
 /**
 *Name: runTest
 *Purpose: This function will, given a 1d array that represents the inital board state,
-	first use that board to create the root node, it will check the return from createRoot
-	to check for the case if we're given a solved puzzle already. It will call processLevel
-	with 1 to signify calling it with only the root node. It will keep a variable to keep track of
-	if we have found a winner or not, if we get to the end of a call of processLevel and have not
-	gotten the winner signal, we'll call it again for the next level.
+	solve it with breadthFirstSolve and print the length of the path and its moves,
+	or, if a search limit stopped it, which and the fewest moves a path can have.
+	It will then print how many nodes were expanded, how many heap allocations the
+	search made doing so, the most heap it held at once and how much the tree
+	held, then free the tree and the boards seen.
 *Parameters: 
 	board --1d Int array to hold the root board
 *Returns:
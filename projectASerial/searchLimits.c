@@ -0,0 +1,173 @@
+/*NAME: searchLimits.c
+DATE: Oct 17th 2026
+VERSION: 1.0
+FILENAME: searchLimits.c
+PURPOSE: This module will keep the budgets a search is run under, the
+	longest path it looks for, the most nodes it expands, the most heap it
+	holds and the most time it takes, so that no engine runs on until it
+	takes all of the memory or never comes back.
+	An engine charges the nodes it has expanded every LIMITCHECKNODES of
+	them, and at the start of every level or pass, with the length of path
+	it is looking at. The first limit that is reached is kept, and the
+	engine backs out, puts the fewest moves it has proven a path must have
+	in with stopAtLimit and returns LIMITREACHED. The nodes charged and the
+	limit are atomic, so the threads of the parallel engines charge the
+	same search.
+AUTHOR: Andrew Gendreau
+*/
+
+#include <stdio.h>
+#include <time.h>
+
+#ifndef SEARCHLIMITS_H_
+#define SEARCHLIMITS_H_
+#include "searchLimits.h"
+#endif
+
+#ifndef MEMORY_H_
+#define MEMORY_H_
+#include "memoryTracker.h"
+#endif
+
+struct searchLimits searchLimits = {0, 0, 0, 0.0};			//no limits unless they are given
+atomic_int limitHit = LIMITNONE;					//limit that stopped the search
+int limitLowerBound = 0;						//fewest moves a path can have
+atomic_ullong limitNodes = 0;						//nodes charged to the search
+struct timespec limitStart;						//when the search started
+
+/**
+*Name: secondsSinceStart
+*Purpose: This function will return how many seconds have passed since
+	startSearchLimits was called.
+*Parameters:
+*	void
+*Returns:
+	the seconds since the search started
+*Author: Andrew Gendreau
+**/
+static double secondsSinceStart(void)
+{
+	struct timespec now;							//current time
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (now.tv_sec - limitStart.tv_sec) + (now.tv_nsec - limitStart.tv_nsec) / 1000000000.0;
+}
+
+/**
+*Name: startSearchLimits
+*Purpose: This function will start the clock of a search and clear the nodes
+	charged to it and the limit it was stopped by.
+*Parameters:
+*	void
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void startSearchLimits(void)
+{
+	clock_gettime(CLOCK_MONOTONIC, &limitStart);
+	atomic_store(&limitNodes, 0);
+	atomic_store(&limitHit, LIMITNONE);
+	limitLowerBound = 0;
+}
+
+/**
+*Name: chargeSearchLimits
+*Purpose: This function will, given nodes an engine has expanded since it last
+	called it and the length of path it is looking at now, add the nodes to the
+	search and check every budget. The first limit reached is kept in limitHit,
+	and is returned from then on. It can be called from many threads at once.
+*Parameters:
+*	nodes --nodes expanded since the last charge
+	depth --moves on the paths being looked at, or the fewest a path can have
+*Returns:
+	LIMITNONE if the search can go on
+	the limit that stopped it otherwise
+*Author: Andrew Gendreau
+**/
+int chargeSearchLimits(unsigned long long nodes, int depth)
+{
+	unsigned long long charged;						//nodes charged with these
+	int reached;								//limit these reach
+	int expected;								//what limitHit has to be to set it
+
+	charged = atomic_fetch_add(&limitNodes, nodes) + nodes;
+	reached = LIMITNONE;
+
+	if(searchLimits.maxDepth > 0 && depth > searchLimits.maxDepth)
+	{
+		reached = LIMITDEPTH;
+	}
+	else if(searchLimits.maxNodes > 0 && charged >= searchLimits.maxNodes)
+	{
+		reached = LIMITNODES;
+	}
+	else if(searchLimits.maxBytes > 0 && memoryUsage.currentBytes > searchLimits.maxBytes)
+	{
+		reached = LIMITBYTES;
+	}
+	else if(searchLimits.maxSeconds > 0 && secondsSinceStart() >= searchLimits.maxSeconds)
+	{
+		reached = LIMITTIME;
+	}
+
+	expected = LIMITNONE;
+
+	if(reached != LIMITNONE)
+	{
+		atomic_compare_exchange_strong(&limitHit, &expected, reached);	//the first thread to reach one sets it
+	}
+
+	return atomic_load(&limitHit);
+}
+
+/**
+*Name: stopAtLimit
+*Purpose: This function will, given the fewest moves an engine has proven a
+	path must have, keep it in limitLowerBound for the report.
+*Parameters:
+*	lowerBound --fewest moves a path can have
+*Returns:
+	LIMITREACHED, for the engine to return
+*Author: Andrew Gendreau
+**/
+int stopAtLimit(int lowerBound)
+{
+	limitLowerBound = lowerBound;
+
+	return LIMITREACHED;
+}
+
+/**
+*Name: reportSearchLimit
+*Purpose: This function will tell the user which limit stopped the search, how
+	many nodes and seconds it had used and the fewest moves a path can have.
+*Parameters:
+*	void
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void reportSearchLimit(void)
+{
+	switch(atomic_load(&limitHit))
+	{
+		case LIMITDEPTH:
+			printf("The depth limit was reached, there is no path of %d moves or fewer\n", searchLimits.maxDepth);
+			break;
+		case LIMITNODES:
+			printf("The node limit of %llu was reached\n", searchLimits.maxNodes);
+			break;
+		case LIMITBYTES:
+			printf("The memory limit of %lu bytes was reached\n", (unsigned long) searchLimits.maxBytes);
+			break;
+		case LIMITTIME:
+			printf("The time limit of %.3f seconds was reached\n", searchLimits.maxSeconds);
+			break;
+	}
+
+	printf("Stopped after %llu nodes and %.3f seconds\n", (unsigned long long) atomic_load(&limitNodes),
+		secondsSinceStart());
+	printf("No path is shorter than %d moves\n", limitLowerBound);
+}
@@ -0,0 +1,86 @@
+/*NAME: searchLimits.h
+DATE: Oct 17th 2026
+VERSION: 1.0
+FILENAME: searchLimits.h
+PURPOSE: This is a header for searchLimits.c
+AUTHOR: Andrew Gendreau
+*/
+
+#include <stddef.h>
+#include <stdatomic.h>
+
+#define LIMITNONE 0						//no limit has been reached
+#define LIMITDEPTH 1						//the search went past maxDepth moves
+#define LIMITNODES 2						//it expanded maxNodes nodes
+#define LIMITBYTES 3						//the heap held went over maxBytes
+#define LIMITTIME 4						//it ran for maxSeconds
+#define LIMITCHECKNODES 1024					//nodes an engine expands between charges
+#define LIMITREACHED -2						//returned by a solve that a limit stopped
+
+/*
+	This is a struct for the budgets a search is given. A budget left at 0
+	is not a limit.
+*/
+struct searchLimits
+{
+	int maxDepth;						//longest path the search looks for
+	unsigned long long maxNodes;				//most nodes it can expand
+	size_t maxBytes;					//most heap it can hold at once
+	double maxSeconds;					//most wall time it can run for
+};
+
+extern struct searchLimits searchLimits;			//budgets of the search being run
+extern atomic_int limitHit;					//limit that stopped the search, LIMITNONE until one does
+extern int limitLowerBound;					//fewest moves a path can have, proven before it stopped
+
+/**
+*Name: startSearchLimits
+*Purpose: This function will start the clock of a search and clear the nodes
+	charged to it and the limit it was stopped by.
+*Parameters:
+*	void
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void startSearchLimits(void);
+
+/**
+*Name: chargeSearchLimits
+*Purpose: This function will, given nodes an engine has expanded since it last
+	called it and the length of path it is looking at now, add the nodes to the
+	search and check every budget. The first limit reached is kept in limitHit,
+	and is returned from then on. It can be called from many threads at once.
+*Parameters:
+*	nodes --nodes expanded since the last charge
+	depth --moves on the paths being looked at, or the fewest a path can have
+*Returns:
+	LIMITNONE if the search can go on
+	the limit that stopped it otherwise
+*Author: Andrew Gendreau
+**/
+int chargeSearchLimits(unsigned long long nodes, int depth);
+
+/**
+*Name: stopAtLimit
+*Purpose: This function will, given the fewest moves an engine has proven a
+	path must have, keep it in limitLowerBound for the report.
+*Parameters:
+*	lowerBound --fewest moves a path can have
+*Returns:
+	LIMITREACHED, for the engine to return
+*Author: Andrew Gendreau
+**/
+int stopAtLimit(int lowerBound);
+
+/**
+*Name: reportSearchLimit
+*Purpose: This function will tell the user which limit stopped the search, how
+	many nodes and seconds it had used and the fewest moves a path can have.
+*Parameters:
+*	void
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void reportSearchLimit(void);
@@ -0,0 +1,323 @@
+/*NAME: searchTree.c
+DATE: Oct 17th 2026
+VERSION: 1.0
+FILENAME: searchTree.c
+PURPOSE: This module will be the tree of board positions the breadth first search
+	builds. It replaces Yggdrasil for the search, a Yggdrasil node kept a copy of its
+	board, its move as a string, an ID and five pointers, well over 100 bytes, when
+	all the search needs to find the path again is the parent and the move. A node
+	here is 16 bytes: the board packed into its key, the index of its parent and the
+	direction that was moved. The tile that moved does not need storing, it sits in
+	the child's board where the parent's blank was.
+	The nodes are kept in an arena in the order they are added, so a node's index
+	never changes and a breadth first search leaves each level as one run of indices
+	straight after the level before it.
+	A lean tree also keeps a 4 byte parent link for every node. A breadth first
+	search only ever looks at the level it is expanding and the one it is adding
+	to, so once a level is done its 16 byte nodes can be released and the links
+	are all that is left of it. The path is then found from the links alone, by
+	walking them up for the directions and replaying those from the root's board
+	to see which tile each one moved.
+AUTHOR: Andrew Gendreau
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifndef SEARCHTREE_H_
+#define SEARCHTREE_H_
+#include "searchTree.h"
+#endif
+
+#ifndef MEMORY_H_
+#define MEMORY_H_
+#include "memoryTracker.h"
+#endif
+
+struct nodeArena searchNodes;						//arena every node of the search tree is taken from
+int leanTree = 0;							//1 if parent links are kept and old levels released
+struct nodeArena parentLinks;						//parent link of every node, lean trees only
+boardKey rootKey;							//board of the root, where a lean path is replayed from
+int rootBlank;								//1d index of the blank on the root board
+
+/**
+*Name: initializeSearchTree
+*Purpose: This function will set up an empty search tree, the
+	arena its nodes are taken from is not allocated until the first node.
+	A lean tree also keeps a parent link for every node, so the nodes
+	of finished levels can be released and the path still found.
+*Parameters:
+*	lean --1 for a lean tree, 0 to keep every node until the end
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void initializeSearchTree(int lean)
+{
+	initializeArena(&searchNodes, sizeof(struct searchNode), NODESPERCHUNK);
+
+	leanTree = lean;
+
+	initializeArena(&parentLinks, sizeof(unsigned int), LINKSPERCHUNK);
+}
+
+/**
+*Name: addSearchNode
+*Purpose: This function will, given a board key, the index of its parent,
+	the direction moved from the parent and the index of the blank, add a
+	node to the end of the search tree.
+*Parameters:
+*	key --key of the board
+	parent --index of the parent node, ROOTPARENT for the root
+	direction --direction code of the move from the parent, NOMOVE for the root
+	blankIndex --1d index of the blank on the board
+*Returns:
+	index of the new node
+*Author: Andrew Gendreau
+**/
+unsigned int addSearchNode(boardKey key, unsigned int parent, int direction, int blankIndex)
+{
+	struct searchNode *newNode;						//node being added
+	unsigned int newIndex;							//index of the node being added
+	unsigned int *newLink;							//parent link of the node being added
+
+	newNode = arenaAllocate(&searchNodes);
+	newIndex = (unsigned int) (searchNodes.recordCount - 1);
+
+	newNode->key = key;
+	newNode->parent = parent;
+	newNode->direction = (unsigned char) direction;
+	newNode->blankIndex = (unsigned char) blankIndex;
+
+	if(parent == ROOTPARENT)
+	{
+		rootKey = key;
+		rootBlank = blankIndex;
+	}
+
+	if(leanTree == 1)
+	{
+		newLink = arenaAllocate(&parentLinks);
+
+		if(parent == ROOTPARENT)
+		{
+			*newLink = ROOTLINK;
+		}
+		else
+		{
+			*newLink = PARENTLINK(parent, direction);
+		}
+	}
+
+	return newIndex;
+}
+
+/**
+*Name: searchNodeAt
+*Purpose: This function will, given the index of a node, return a pointer to it.
+	Nodes never move, so the pointer stays good until the tree is released.
+*Parameters:
+*	index --index of the node
+*Returns:
+	pointer to the node
+*Author: Andrew Gendreau
+**/
+struct searchNode *searchNodeAt(unsigned int index)
+{
+	return arenaRecord(&searchNodes, index);
+}
+
+/**
+*Name: searchNodeCount
+*Purpose: This function will return how many nodes are in the search tree,
+	which is also the index the next node will get.
+*Parameters:
+	void
+*Returns:
+	number of nodes
+*Author: Andrew Gendreau
+**/
+unsigned int searchNodeCount()
+{
+	return (unsigned int) searchNodes.recordCount;
+}
+
+/**
+*Name: releaseSearchNodesBefore
+*Purpose: This function will, in a lean tree, release the nodes before the
+	given index, as far as whole chunks of the arena allow. Their parent
+	links are kept. In a full tree it does nothing.
+*Parameters:
+*	index --first node that has to be kept
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void releaseSearchNodesBefore(unsigned int index)
+{
+	if(leanTree == 1)
+	{
+		releaseChunksBefore(&searchNodes, index);
+	}
+}
+
+/**
+*Name: traceLinkPath
+*Purpose: This function will, given the index of a node in a lean tree, walk
+	the parent links up to the root once, storing the directions last to first,
+	then turn them around and replay them from the root's board. Each move
+	slides the tile next to the blank in that direction, so the replay finds
+	that tile from the move tables and reads it out of the board.
+*Parameters:
+*	index --index of the last node on the path
+	path --path to fill
+*Returns:
+	the number of moves on the path
+	-1 if the path is longer than MAXPATHLENGTH
+*Author: Andrew Gendreau
+**/
+static int traceLinkPath(unsigned int index, struct movePath *path)
+{
+	unsigned int link;							//parent link of the current node
+	moveCode temp;								//temporary storage for turning the path around
+	boardKey key;								//board as the path is replayed
+	int blankIndex;								//blank on that board
+	int tileIndex;								//1d index of the tile the current move slides
+	int direction;								//direction of the current move
+	int i;									//loop control variable
+	int j;									//another loop control variable
+
+	path->length = 0;
+	link = *(unsigned int *) arenaRecord(&parentLinks, index);
+
+	while(link != ROOTLINK)
+	{
+		if(path->length == MAXPATHLENGTH)
+		{
+			return -1;
+		}
+
+		path->moves[path->length] = (moveCode) LINKDIRECTION(link);
+		path->length++;
+		link = *(unsigned int *) arenaRecord(&parentLinks, LINKPARENT(link));
+	}
+
+	for(i = 0; i < path->length / 2; i++)
+	{
+		temp = path->moves[i];
+		path->moves[i] = path->moves[path->length - 1 - i];
+		path->moves[path->length - 1 - i] = temp;
+	}
+
+	key = rootKey;
+	blankIndex = rootBlank;
+
+	for(i = 0; i < path->length; i++)
+	{
+		direction = path->moves[i];
+		tileIndex = blankIndex;
+
+		for(j = 0; j < movesForBlank[blankIndex]; j++)
+		{
+			if(directionsForBlank[blankIndex][j] == direction)
+			{
+				tileIndex = tilesForBlank[blankIndex][j];
+			}
+		}
+
+		path->moves[i] = MOVECODE(KEYTILE(key, tileIndex), direction);
+		key = applyMoveToKey(key, blankIndex, tileIndex);
+		blankIndex = tileIndex;
+	}
+
+	return path->length;
+}
+
+/**
+*Name: traceSearchPath
+*Purpose: This function will, given the index of a node, walk the parent
+	indices up to the root once and fill path with the moves made from the
+	root to that node. The walk finds the moves last to first, so they are
+	stored in that order and turned around at the end. A lean tree may have
+	released the nodes on the path, so it walks the parent links instead.
+*Parameters:
+*	index --index of the last node on the path
+	path --path to fill
+*Returns:
+	the number of moves on the path
+	-1 if the path is longer than MAXPATHLENGTH
+*Author: Andrew Gendreau
+**/
+int traceSearchPath(unsigned int index, struct movePath *path)
+{
+	struct searchNode *currentNode;						//node we are looking at
+	struct searchNode *parentNode;						//its parent
+	moveCode temp;								//temporary storage for turning the path around
+	int i;									//loop control variable
+
+	if(leanTree == 1)
+	{
+		return traceLinkPath(index, path);
+	}
+
+	path->length = 0;
+
+	for(currentNode = searchNodeAt(index); currentNode->parent != ROOTPARENT; currentNode = parentNode)
+	{
+		if(path->length == MAXPATHLENGTH)
+		{
+			return -1;
+		}
+
+		parentNode = searchNodeAt(currentNode->parent);
+
+		path->moves[path->length] = MOVECODE(KEYTILE(currentNode->key, parentNode->blankIndex),
+			currentNode->direction);
+		path->length++;
+	}
+
+	for(i = 0; i < path->length / 2; i++)
+	{
+		temp = path->moves[i];
+		path->moves[i] = path->moves[path->length - 1 - i];
+		path->moves[path->length - 1 - i] = temp;
+	}
+
+	return path->length;
+}
+
+/**
+*Name: printSearchTreeStats
+*Purpose: This function will print how much memory the search tree holds,
+	its nodes and, in a lean tree, its parent links.
+*Parameters:
+	void
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void printSearchTreeStats()
+{
+	printArenaStats(&searchNodes, "Search tree");
+
+	if(leanTree == 1)
+	{
+		printArenaStats(&parentLinks, "Parent link");
+	}
+}
+
+/**
+*Name: releaseSearchTree
+*Purpose: This function will free all of the search tree's nodes and parent
+	links at once.
+*Parameters:
+	void
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void releaseSearchTree()
+{
+	releaseArena(&searchNodes);
+	releaseArena(&parentLinks);
+}
@@ -0,0 +1,158 @@
+/*NAME: searchTree.h
+DATE: Oct 17th 2026
+VERSION: 1.0
+FILENAME: searchTree.h
+PURPOSE: This is a header for searchTree.c
+AUTHOR: Andrew Gendreau
+*/
+
+#ifndef BOARDKEY_H_
+#define BOARDKEY_H_
+#include "boardKey.h"
+#endif
+
+#ifndef MOVEPATH_H_
+#define MOVEPATH_H_
+#include "movePath.h"
+#endif
+
+#ifndef ARENA_H_
+#define ARENA_H_
+#include "nodeArena.h"
+#endif
+
+#define ROOTPARENT 0xFFFFFFFFU					//parent index of the root, it has no parent
+#define LINKSPERCHUNK 4096					//parent links held by each chunk of the link arena, as many as a node chunk
+#define ROOTLINK 0xFFFFFFFFU					//parent link of the root
+
+/*
+* In a lean tree every node also gets a 4 byte parent link, the parent's
+* index in the top 30 bits and the direction code of the move in the bottom
+* two. PARENTLINK packs a link, LINKPARENT and LINKDIRECTION unpack it.
+*/
+#define PARENTLINK(parent, direction) (((parent) << 2) | (unsigned int) (direction))
+#define LINKPARENT(link) ((link) >> 2)
+#define LINKDIRECTION(link) ((int) ((link) & 3))
+
+/*
+	This is a struct for one node of the search tree, packed into 16 bytes.
+	The board is its key, the parent is the index of the parent node in the
+	tree's arena and the move is only the direction code, the tile that moved
+	is the one in the parent's blank spot, so it can be read out of the key.
+	Nothing points down the tree, children are found by expanding a node,
+	and the path is found by walking parent indices up from the winner.
+*/
+struct searchNode
+{
+	boardKey key;						//the board of this node
+	unsigned int parent;					//index of the parent node, ROOTPARENT for the root
+	unsigned char direction;				//direction code of the move from the parent, NOMOVE for the root
+	unsigned char blankIndex;				//1d index of the blank on this board
+	unsigned char spare[2];					//unused, keeps the node at 16 bytes
+};
+
+/**
+*Name: initializeSearchTree
+*Purpose: This function will set up an empty search tree, the
+	arena its nodes are taken from is not allocated until the first node.
+	A lean tree also keeps a parent link for every node, so the nodes
+	of finished levels can be released and the path still found.
+*Parameters:
+*	lean --1 for a lean tree, 0 to keep every node until the end
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void initializeSearchTree(int lean);
+
+/**
+*Name: addSearchNode
+*Purpose: This function will, given a board key, the index of its parent,
+	the direction moved from the parent and the index of the blank, add a
+	node to the end of the search tree.
+*Parameters:
+*	key --key of the board
+	parent --index of the parent node, ROOTPARENT for the root
+	direction --direction code of the move from the parent, NOMOVE for the root
+	blankIndex --1d index of the blank on the board
+*Returns:
+	index of the new node
+*Author: Andrew Gendreau
+**/
+unsigned int addSearchNode(boardKey key, unsigned int parent, int direction, int blankIndex);
+
+/**
+*Name: searchNodeAt
+*Purpose: This function will, given the index of a node, return a pointer to it.
+	Nodes never move, so the pointer stays good until the tree is released.
+*Parameters:
+*	index --index of the node
+*Returns:
+	pointer to the node
+*Author: Andrew Gendreau
+**/
+struct searchNode *searchNodeAt(unsigned int index);
+
+/**
+*Name: searchNodeCount
+*Purpose: This function will return how many nodes are in the search tree,
+	which is also the index the next node will get.
+*Parameters:
+	void
+*Returns:
+	number of nodes
+*Author: Andrew Gendreau
+**/
+unsigned int searchNodeCount();
+
+/**
+*Name: releaseSearchNodesBefore
+*Purpose: This function will, in a lean tree, release the nodes before the
+	given index, as far as whole chunks of the arena allow. Their parent
+	links are kept. In a full tree it does nothing.
+*Parameters:
+*	index --first node that has to be kept
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void releaseSearchNodesBefore(unsigned int index);
+
+/**
+*Name: traceSearchPath
+*Purpose: This function will, given the index of a node, walk the parent
+	indices up to the root once and fill path with the moves made from the
+	root to that node. A lean tree walks the parent links instead.
+*Parameters:
+*	index --index of the last node on the path
+	path --path to fill
+*Returns:
+	the number of moves on the path
+	-1 if the path is longer than MAXPATHLENGTH
+*Author: Andrew Gendreau
+**/
+int traceSearchPath(unsigned int index, struct movePath *path);
+
+/**
+*Name: printSearchTreeStats
+*Purpose: This function will print how much memory the search tree holds,
+	its nodes and, in a lean tree, its parent links.
+*Parameters:
+	void
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void printSearchTreeStats();
+
+/**
+*Name: releaseSearchTree
+*Purpose: This function will free all of the search tree's nodes and parent
+	links at once.
+*Parameters:
+	void
+*Returns:
+	void
+*Author: Andrew Gendreau
+**/
+void releaseSearchTree();